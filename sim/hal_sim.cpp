@@ -0,0 +1,439 @@
+/*
+ * HAL implementation for the Linux simulator
+ *
+ * Display calls are recorded, camera frames come from files (or a
+ * synthetic scene), the network stream is a real TCP socket to the mock
+ * server, and every call charges its modelled cost to the virtual clock.
+ */
+
+#include "hal.h"
+#include "sim_clock.h"
+#include "sim_hal.h"
+
+#include <arpa/inet.h>
+#include <dirent.h>
+#include <limits.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define SIM_FRAME_WIDTH 320
+#define SIM_FRAME_HEIGHT 240
+#define SIM_FRAME_BYTES (SIM_FRAME_WIDTH * SIM_FRAME_HEIGHT * 2)
+#define SIM_MAX_FRAMES 32
+
+// ---- Display ----
+
+#define SIM_SCREEN_WIDTH 240
+#define SIM_SCREEN_HEIGHT 320
+
+static SimDisplayStats displayStats;
+static uint16_t screen[SIM_SCREEN_WIDTH * SIM_SCREEN_HEIGHT];
+static FILE* displayLog = nullptr;
+
+static void logDraw(const char* format, ...) __attribute__((format(printf, 1, 2)));
+static void logDraw(const char* format, ...) {
+    if (displayLog == nullptr) return;
+    fprintf(displayLog, "t=%lu ", millis());
+    va_list args;
+    va_start(args, format);
+    vfprintf(displayLog, format, args);
+    va_end(args);
+    fputc('\n', displayLog);
+}
+
+const SimDisplayStats& simDisplayStats() {
+    return displayStats;
+}
+
+const uint16_t* simDisplayPixels() {
+    return screen;
+}
+
+void simDisplaySetLog(FILE* log) {
+    displayLog = log;
+}
+
+void halInit() {
+    // Buttons are scripted by sim_main.cpp, nothing to wire up
+}
+
+void halDisplayClear() {
+    displayStats.clears++;
+    simAdvance(STAGE_DISPLAY, SIM_CLEAR_US);
+    logDraw("clear");
+}
+
+void halDisplayClearLine(int line) {
+    displayStats.lineClears++;
+    simAdvance(STAGE_DISPLAY, SIM_TEXT_CALL_US);
+    logDraw("clearLine %d", line);
+}
+
+void halDisplayBackground(uint32_t color) {
+    simAdvance(STAGE_DISPLAY, SIM_CLEAR_US);
+    logDraw("background #%06X", (unsigned)color);
+}
+
+void halDisplayRect(int x, int y, int width, int height, uint32_t color) {
+    displayStats.rects++;
+    simAdvance(STAGE_DISPLAY, (uint64_t)width * height * SIM_RECT_US_PER_KPIXEL / 1000);
+    logDraw("rect %d,%d %dx%d #%06X", x, y, width, height, (unsigned)color);
+}
+
+static void drawText(const char* text) {
+    size_t len = strlen(text);
+    displayStats.texts++;
+    displayStats.textChars += len;
+    simAdvance(STAGE_DISPLAY, SIM_TEXT_CALL_US + len * SIM_TEXT_US_PER_CHAR);
+}
+
+void halDisplayText(const char* text, int x, int y, uint32_t color, int maxChars) {
+    (void)maxChars;  // Wrapping is not modelled, cost is per character
+    drawText(text);
+    logDraw("text %d,%d #%06X \"%s\"", x, y, (unsigned)color, text);
+}
+
+void halDisplayTextLine(const char* text, int line, uint32_t color) {
+    drawText(text);
+    logDraw("textLine %d #%06X \"%s\"", line, (unsigned)color, text);
+}
+
+void halDisplayBlit(int x, int y, int width, int height, const uint16_t* pixels) {
+    displayStats.blits++;
+    displayStats.blitPixels += (long)width * height;
+    simAdvance(STAGE_DISPLAY, (uint64_t)width * height * SIM_BLIT_US_PER_KPIXEL / 1000);
+    logDraw("blit %d,%d %dx%d", x, y, width, height);
+
+    // Really copy it, so host CPU time includes the copy
+    for (int row = 0; row < height; row++) {
+        int sy = y + row;
+        if (sy < 0 || sy >= SIM_SCREEN_HEIGHT) continue;
+        int x0 = max(x, 0);
+        int x1 = min(x + width, SIM_SCREEN_WIDTH);
+        if (x0 < x1) {
+            memcpy(screen + sy * SIM_SCREEN_WIDTH + x0, pixels + row * width + (x0 - x),
+                   (x1 - x0) * sizeof(uint16_t));
+        }
+    }
+}
+
+void halDisplayUpdate() {
+    displayStats.updates++;
+    simAdvance(STAGE_DISPLAY, SIM_FLUSH_US);
+    logDraw("update");
+}
+
+// ---- Camera ----
+
+static uint8_t* frames = nullptr;   // numFrames * SIM_FRAME_BYTES, loaded once
+static int numFrames = 0;
+static int nextFrame = 0;
+static HalFrame currentFrame;
+
+static int compareNames(const void* a, const void* b) {
+    return strcmp((const char*)a, (const char*)b);
+}
+
+int simCameraLoadFrames(const char* dir) {
+    DIR* d = opendir(dir);
+    if (d == nullptr) return 0;
+
+    static char names[SIM_MAX_FRAMES][256];
+    int count = 0;
+    struct dirent* entry;
+    while ((entry = readdir(d)) != nullptr && count < SIM_MAX_FRAMES) {
+        const char* ext = strrchr(entry->d_name, '.');
+        if (ext != nullptr && strcmp(ext, ".rgb565") == 0) {
+            strlcpy(names[count++], entry->d_name, sizeof(names[0]));
+        }
+    }
+    closedir(d);
+    qsort(names, count, sizeof(names[0]), compareNames);
+
+    frames = (uint8_t*)realloc(frames, (size_t)(count > 0 ? count : 1) * SIM_FRAME_BYTES);
+    numFrames = 0;
+    for (int i = 0; i < count; i++) {
+        char path[PATH_MAX];
+        strlcpy(path, dir, sizeof(path));
+        strlcat(path, "/", sizeof(path));
+        strlcat(path, names[i], sizeof(path));
+        FILE* f = fopen(path, "rb");
+        if (f == nullptr) continue;
+        if (fread(frames + numFrames * SIM_FRAME_BYTES, 1, SIM_FRAME_BYTES, f) == SIM_FRAME_BYTES) {
+            numFrames++;
+        } else {
+            fprintf(stderr, "sim: %s is not a %dx%d RGB565 frame\n", path, SIM_FRAME_WIDTH, SIM_FRAME_HEIGHT);
+        }
+        fclose(f);
+    }
+    return numFrames;
+}
+
+// Deterministic pseudo-random numbers (xorshift32)
+static uint32_t rngState = 0x12345678;
+
+static uint32_t nextRandom() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+static void putPixel(uint8_t* frame, int x, int y, int r, int g, int b) {
+    r = r < 0 ? 0 : (r > 255 ? 255 : r);
+    g = g < 0 ? 0 : (g > 255 ? 255 : g);
+    b = b < 0 ? 0 : (b > 255 ? 255 : b);
+    uint16_t pixel = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+    frame[(y * SIM_FRAME_WIDTH + x) * 2] = pixel & 0xFF;
+    frame[(y * SIM_FRAME_WIDTH + x) * 2 + 1] = pixel >> 8;
+}
+
+// Synthetic scene: grey shelf with one to four coloured produce blobs
+static void generateFrame(uint8_t* frame, int index) {
+    static const uint8_t COLORS[5][3] = {
+        {110, 40, 120},   // eggplant
+        {235, 210, 40},   // lemon
+        {50, 150, 50},    // cucumber
+        {220, 40, 30},    // tomato
+        {200, 150, 90},   // onion
+    };
+
+    for (int y = 0; y < SIM_FRAME_HEIGHT; y++) {
+        for (int x = 0; x < SIM_FRAME_WIDTH; x++) {
+            int v = 150 + (int)(nextRandom() % 40) - 20;
+            putPixel(frame, x, y, v, v, v);
+        }
+    }
+
+    // One blob fills the middle of the frame, more go into grid cells
+    int blobs = 1 + index % 4;
+    int rx = blobs == 1 ? 100 : 60;
+    int ry = blobs == 1 ? 80 : 45;
+    for (int i = 0; i < blobs; i++) {
+        const uint8_t* c = COLORS[(index + i) % 5];
+        int cx = blobs == 1 ? 160 : (i % 2) * 160 + 80;
+        int cy = blobs == 1 ? 120 : (i / 2) * 120 + 60;
+        for (int y = cy - ry; y < cy + ry; y++) {
+            for (int x = cx - rx; x < cx + rx; x++) {
+                int dx = x - cx;
+                int dy = y - cy;
+                if (dx * dx * ry * ry + dy * dy * rx * rx > rx * rx * ry * ry) continue;
+                int n = (int)(nextRandom() % 20) - 10;
+                putPixel(frame, x, y, c[0] + n, c[1] + n, c[2] + n);
+            }
+        }
+    }
+}
+
+bool halCameraInit() {
+    simAdvance(STAGE_CAMERA, SIM_CAMERA_INIT_US);
+    if (frames == nullptr) {
+        frames = (uint8_t*)malloc(SIM_FRAME_BYTES);
+    }
+    return frames != nullptr;
+}
+
+void halCameraPreview(bool on) {
+    logDraw("cameraPreview %s", on ? "on" : "off");
+}
+
+HalFrame* halCameraCapture() {
+    if (frames == nullptr) return nullptr;
+    simAdvance(STAGE_CAMERA, SIM_CAPTURE_US);
+
+    uint8_t* frame;
+    if (numFrames > 0) {
+        frame = frames + (nextFrame % numFrames) * SIM_FRAME_BYTES;
+    } else {
+        frame = frames;
+        generateFrame(frame, nextFrame);
+    }
+    nextFrame++;
+
+    currentFrame.buf = frame;
+    currentFrame.len = SIM_FRAME_BYTES;
+    currentFrame.width = SIM_FRAME_WIDTH;
+    currentFrame.height = SIM_FRAME_HEIGHT;
+    return &currentFrame;
+}
+
+void halCameraRelease(HalFrame* frame) {
+    (void)frame;  // Frames live in the simulator's frame buffer
+}
+
+// ---- LED ----
+
+void halLed(uint8_t r, uint8_t g, uint8_t b) {
+    logDraw("led %u,%u,%u", r, g, b);
+}
+
+// ---- WiFi / time ----
+
+static uint64_t wifiReadyUs = UINT64_MAX;
+static uint64_t timeReadyUs = UINT64_MAX;
+
+// Virtual wall clock starts at 2026-01-01 00:00 UTC once NTP has synced
+#define SIM_EPOCH_START 1767225600
+
+void halNetworkBegin(const char* ssid, const char* password) {
+    (void)ssid;
+    (void)password;
+    wifiReadyUs = simNowUs() + SIM_WIFI_CONNECT_US;
+}
+
+bool halNetworkConnected() {
+    return simNowUs() >= wifiReadyUs;
+}
+
+const char* halNetworkAddress() {
+    return "127.0.0.1";
+}
+
+void halTimeSyncBegin() {
+    timeReadyUs = simNowUs() + SIM_NTP_SYNC_US;
+}
+
+time_t halTime() {
+    uint64_t seconds = simNowUs() / 1000000;
+    return simNowUs() >= timeReadyUs ? (time_t)(SIM_EPOCH_START + seconds) : (time_t)seconds;
+}
+
+// ---- Network connection (plain TCP to the mock server) ----
+
+static int sock = -1;
+static bool awaitingResponse = false;
+
+bool halNetConnect(const char* host, uint16_t port, bool secure) {
+    (void)secure;  // The mock server speaks plain HTTP
+    halNetStop();
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    if (inet_pton(AF_INET, host, &addr.sin_addr) != 1) {
+        fprintf(stderr, "sim: only numeric IPv4 hosts are supported (%s)\n", host);
+        return false;
+    }
+
+    sock = socket(AF_INET, SOCK_STREAM, 0);
+    if (sock < 0) return false;
+    if (connect(sock, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+        close(sock);
+        sock = -1;
+        return false;
+    }
+    int one = 1;
+    setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    // The device always talks TLS, so charge a handshake either way
+    simAdvance(STAGE_NETWORK, SIM_TLS_CONNECT_US);
+    return true;
+}
+
+bool halNetConnected() {
+    if (sock < 0) return false;
+
+    // Peer closed: readable with zero bytes pending
+    struct pollfd pfd = {sock, POLLIN, 0};
+    if (poll(&pfd, 1, 0) > 0) {
+        char c;
+        if (recv(sock, &c, 1, MSG_PEEK | MSG_DONTWAIT) == 0) {
+            halNetStop();
+            return false;
+        }
+    }
+    return true;
+}
+
+void halNetStop() {
+    if (sock >= 0) close(sock);
+    sock = -1;
+    awaitingResponse = false;
+}
+
+size_t halNetWrite(const uint8_t* data, size_t len) {
+    if (sock < 0) return 0;
+
+    size_t sent = 0;
+    while (sent < len) {
+        ssize_t n = send(sock, data + sent, len - sent, MSG_NOSIGNAL);
+        if (n <= 0) break;
+        sent += n;
+    }
+    simAdvance(STAGE_NETWORK, sent * SIM_NET_US_PER_KB / 1024);
+    awaitingResponse = true;
+    return sent;
+}
+
+// Wait (real time) for data, charging the round trip on the first byte
+static bool waitReadable(uint32_t timeoutMs) {
+    struct pollfd pfd = {sock, POLLIN, 0};
+    if (poll(&pfd, 1, (int)timeoutMs) <= 0) return false;
+
+    if (awaitingResponse) {
+        simAdvance(STAGE_NETWORK, SIM_RTT_US);
+        awaitingResponse = false;
+    }
+    return true;
+}
+
+size_t halNetRead(char* buffer, size_t len, uint32_t timeoutMs) {
+    size_t got = 0;
+    while (sock >= 0 && got < len && waitReadable(timeoutMs)) {
+        ssize_t n = recv(sock, buffer + got, len - got, 0);
+        if (n <= 0) break;
+        got += n;
+    }
+    simAdvance(STAGE_NETWORK, got * SIM_NET_US_PER_KB / 1024);
+    return got;
+}
+
+size_t halNetReadUntil(char terminator, char* buffer, size_t len, uint32_t timeoutMs) {
+    size_t got = 0;
+    while (sock >= 0 && got < len && waitReadable(timeoutMs)) {
+        char c;
+        if (recv(sock, &c, 1, 0) != 1) break;
+        if (c == terminator) break;
+        buffer[got++] = c;
+    }
+    simAdvance(STAGE_NETWORK, got * SIM_NET_US_PER_KB / 1024);
+    return got;
+}
+
+// Tasks run to completion on their own lane, so nothing ever contends for
+// the lock; taking it twice would deadlock the device, so report that
+static int netLockDepth = 0;
+
+void halNetLock() {
+    if (netLockDepth++ > 0) fprintf(stderr, "sim: network lock taken twice\n");
+}
+
+void halNetUnlock() {
+    if (--netLockDepth < 0) fprintf(stderr, "sim: network lock released while not held\n");
+}
+
+// ---- Misc ----
+
+static uint64_t lastTaskUs = 0;
+
+void halStartTask(void (*fn)(void*), const char* name, void* param) {
+    (void)name;
+    // Runs to completion now on a parallel lane of the virtual clock, as if
+    // on the second core. Its side effects are visible immediately; work
+    // that must not be ready early (the model) gates itself on the clock.
+    lastTaskUs = simRunLane(fn, param);
+}
+
+uint64_t simLastTaskUs() {
+    return lastTaskUs;
+}
+
+long halRandom(long minValue, long maxValue) {
+    if (maxValue <= minValue) return minValue;
+    return minValue + (long)(nextRandom() % (uint32_t)(maxValue - minValue));
+}
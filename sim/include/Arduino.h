@@ -0,0 +1,98 @@
+/*
+ * Arduino core subset for the Linux simulator
+ *
+ * Only what the shared modules use: Serial, millis/micros/delay on the
+ * virtual clock, ps_malloc and a few libc gaps. Board hardware is not
+ * here - it goes through hal.h.
+ */
+
+#ifndef SIM_ARDUINO_H
+#define SIM_ARDUINO_H
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+#include <algorithm>
+
+using std::max;
+using std::min;
+
+// Declared by vegetable_classifier.h, not used by the simulator
+class String;
+
+// Serial: app logs go to stdout unless silenced with simSerialEnable(false)
+void simSerialEnable(bool enabled);
+bool simSerialEnabled();
+
+class SimSerial {
+public:
+    void begin(unsigned long) {}
+
+    int printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+        if (!simSerialEnabled()) return 0;
+        va_list args;
+        va_start(args, format);
+        int n = vprintf(format, args);
+        va_end(args);
+        return n;
+    }
+
+    void print(const char* text) {
+        if (simSerialEnabled()) fputs(text, stdout);
+    }
+
+    void println(const char* text = "") {
+        if (simSerialEnabled()) puts(text);
+    }
+
+    int available() {
+        return 0;
+    }
+
+    int read() {
+        return -1;
+    }
+};
+
+extern SimSerial Serial;
+
+// Virtual clock
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+// No separate PSRAM on the host
+inline void* ps_malloc(size_t size) {
+    return malloc(size);
+}
+
+// FreeRTOS critical sections are no-ops (single-threaded simulator)
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+
+#if defined(__GLIBC__) && (__GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38))
+inline size_t strlcpy(char* dst, const char* src, size_t size) {
+    size_t len = strlen(src);
+    if (size > 0) {
+        size_t n = len < size - 1 ? len : size - 1;
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return len;
+}
+
+inline size_t strlcat(char* dst, const char* src, size_t size) {
+    size_t used = strnlen(dst, size);
+    if (used == size) return size + strlen(src);
+    return used + strlcpy(dst + used, src, size - used);
+}
+#endif
+
+#endif // SIM_ARDUINO_H
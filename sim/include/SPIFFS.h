@@ -0,0 +1,94 @@
+/*
+ * SPIFFS subset for the Linux simulator, backed by a host directory
+ */
+
+#ifndef SIM_SPIFFS_H
+#define SIM_SPIFFS_H
+
+#include <Arduino.h>
+#include <sys/stat.h>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+class File {
+public:
+    File(FILE* fp = nullptr) : fp(fp) {}
+
+    explicit operator bool() const {
+        return fp != nullptr;
+    }
+
+    int read() {
+        return fp ? fgetc(fp) : -1;
+    }
+
+    size_t read(uint8_t* buffer, size_t len) {
+        return fp ? fread(buffer, 1, len, fp) : 0;
+    }
+
+    size_t write(const uint8_t* buffer, size_t len) {
+        return fp ? fwrite(buffer, 1, len, fp) : 0;
+    }
+
+    int printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+        if (!fp) return 0;
+        va_list args;
+        va_start(args, format);
+        int n = vfprintf(fp, format, args);
+        va_end(args);
+        return n;
+    }
+
+    size_t size() {
+        if (!fp) return 0;
+        struct stat st;
+        return fstat(fileno(fp), &st) == 0 ? (size_t)st.st_size : 0;
+    }
+
+    int available() {
+        if (!fp) return 0;
+        int c = fgetc(fp);
+        if (c == EOF) return 0;
+        ungetc(c, fp);
+        return 1;
+    }
+
+    size_t readBytesUntil(char terminator, char* buffer, size_t len) {
+        size_t n = 0;
+        int c;
+        while (fp && n < len && (c = fgetc(fp)) != EOF && c != terminator) {
+            buffer[n++] = (char)c;
+        }
+        return n;
+    }
+
+    void close() {
+        if (fp) fclose(fp);
+        fp = nullptr;
+    }
+
+private:
+    FILE* fp;
+};
+
+class SimSPIFFS {
+public:
+    // Directory that stands in for the flash partition
+    void setRoot(const char* dir);
+
+    bool begin(bool formatOnFail = false);
+    File open(const char* path, const char* mode);
+    bool exists(const char* path);
+    bool remove(const char* path);
+
+private:
+    const char* hostPath(const char* path);
+    char root[256] = ".";
+    char pathBuffer[512];
+};
+
+extern SimSPIFFS SPIFFS;
+
+#endif // SIM_SPIFFS_H
@@ -0,0 +1,236 @@
+/*
+ * Mock inventory API implementation
+ */
+
+#include "mock_server.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define MOCK_MAX_ITEMS 1000
+#define MOCK_REQUEST_MAX 4096
+#define MOCK_CHUNK_SIZE 1000  // Odd size so chunk boundaries fall inside JSON tokens
+
+struct MockItem {
+    char name[32];
+    int quantity;
+    char expiry[11];
+};
+
+static pid_t serverPid = -1;
+static MockItem items[MOCK_MAX_ITEMS];
+static int numItems = 0;
+
+static const char* SEED_NAMES[] = {
+    "tomato", "lemon", "cucumber", "eggplant", "onion",
+    "carrot", "spinach", "milk", "eggs", "butter"
+};
+
+static void seedItems(int count) {
+    numItems = 0;
+    for (int i = 0; i < count && i < MOCK_MAX_ITEMS; i++) {
+        MockItem& item = items[numItems++];
+        snprintf(item.name, sizeof(item.name), "%s", SEED_NAMES[i % 10]);
+        if (i >= 10) {
+            snprintf(item.name, sizeof(item.name), "%s %d", SEED_NAMES[i % 10], i / 10 + 1);
+        }
+        item.quantity = 1 + i % 6;
+        // Spread expiry over the first weeks of 2026 (the simulated clock)
+        snprintf(item.expiry, sizeof(item.expiry), "2026-01-%02d", 1 + (i * 3) % 28);
+    }
+}
+
+// Pull a string / integer field out of a flat JSON object (good enough for the app's POST body)
+static void jsonString(const char* body, const char* key, char* out, size_t len) {
+    char pattern[40];
+    snprintf(pattern, sizeof(pattern), "\"%s\":\"", key);
+    const char* p = strstr(body, pattern);
+    out[0] = '\0';
+    if (p == nullptr) return;
+    p += strlen(pattern);
+    size_t n = 0;
+    while (*p && *p != '"' && n < len - 1) out[n++] = *p++;
+    out[n] = '\0';
+}
+
+static int jsonInt(const char* body, const char* key) {
+    char pattern[40];
+    snprintf(pattern, sizeof(pattern), "\"%s\":", key);
+    const char* p = strstr(body, pattern);
+    return p ? atoi(p + strlen(pattern)) : 0;
+}
+
+static bool sendAll(int fd, const char* data, size_t len) {
+    while (len > 0) {
+        ssize_t n = send(fd, data, len, MSG_NOSIGNAL);
+        if (n <= 0) return false;
+        data += n;
+        len -= n;
+    }
+    return true;
+}
+
+static bool respond(int fd, int status, const char* body, size_t bodyLen) {
+    char header[160];
+    int headerLen = snprintf(header, sizeof(header),
+                             "HTTP/1.1 %d %s\r\n"
+                             "Content-Type: application/json\r\n"
+                             "Content-Length: %zu\r\n"
+                             "Connection: keep-alive\r\n\r\n",
+                             status, status == 200 ? "OK" : status == 201 ? "Created" : "Not Found",
+                             bodyLen);
+    return sendAll(fd, header, headerLen) && sendAll(fd, body, bodyLen);
+}
+
+// Same as respond() with Transfer-Encoding: chunked
+static bool respondChunked(int fd, int status, const char* body, size_t bodyLen) {
+    char header[160];
+    int headerLen = snprintf(header, sizeof(header),
+                             "HTTP/1.1 %d %s\r\n"
+                             "Content-Type: application/json\r\n"
+                             "Transfer-Encoding: chunked\r\n"
+                             "Connection: keep-alive\r\n\r\n",
+                             status, status == 200 ? "OK" : "Not Found");
+    if (!sendAll(fd, header, headerLen)) return false;
+
+    while (bodyLen > 0) {
+        size_t n = bodyLen < MOCK_CHUNK_SIZE ? bodyLen : MOCK_CHUNK_SIZE;
+        char size[16];
+        int sizeLen = snprintf(size, sizeof(size), "%zx\r\n", n);
+        if (!sendAll(fd, size, sizeLen) || !sendAll(fd, body, n) || !sendAll(fd, "\r\n", 2)) {
+            return false;
+        }
+        body += n;
+        bodyLen -= n;
+    }
+    return sendAll(fd, "0\r\n\r\n", 5);
+}
+
+// The list goes out chunked and the POST reply with Content-Length, so
+// both body framings of the client are exercised
+static bool serveList(int fd) {
+    static char body[MOCK_MAX_ITEMS * 128];
+    size_t len = 0;
+    body[len++] = '[';
+    for (int i = 0; i < numItems; i++) {
+        len += snprintf(body + len, sizeof(body) - len,
+                        "%s{\"id\":%d,\"name\":\"%s\",\"category\":\"vegetable\","
+                        "\"quantity\":%d,\"unit\":\"pieces\",\"expiry_date\":\"%s\"}",
+                        i > 0 ? "," : "", i + 1, items[i].name, items[i].quantity, items[i].expiry);
+    }
+    body[len++] = ']';
+    return respondChunked(fd, 200, body, len);
+}
+
+// Serve requests on one connection until the client closes it
+static void serveConnection(int fd) {
+    static char request[MOCK_REQUEST_MAX + 1];
+    size_t have = 0;
+
+    for (;;) {
+        char* headerEnd = have > 0 ? strstr(request, "\r\n\r\n") : nullptr;
+        if (headerEnd == nullptr) {
+            if (have >= MOCK_REQUEST_MAX) return;
+            ssize_t n = recv(fd, request + have, MOCK_REQUEST_MAX - have, 0);
+            if (n <= 0) return;
+            have += n;
+            request[have] = '\0';
+            continue;
+        }
+
+        size_t headerLen = headerEnd + 4 - request;
+        const char* cl = strcasestr(request, "Content-Length:");
+        size_t bodyLen = (cl != nullptr && cl < headerEnd) ? (size_t)atoi(cl + 15) : 0;
+        while (have < headerLen + bodyLen && have < MOCK_REQUEST_MAX) {
+            ssize_t n = recv(fd, request + have, MOCK_REQUEST_MAX - have, 0);
+            if (n <= 0) return;
+            have += n;
+            request[have] = '\0';
+        }
+
+        bool ok;
+        if (strncmp(request, "GET ", 4) == 0 && strstr(request, "/ingredients ") != nullptr) {
+            ok = serveList(fd);
+        } else if (strncmp(request, "POST ", 5) == 0 && strstr(request, "/ingredients ") != nullptr) {
+            char saved = request[headerLen + bodyLen];
+            request[headerLen + bodyLen] = '\0';
+            const char* body = request + headerLen;
+            if (numItems < MOCK_MAX_ITEMS) {
+                MockItem& item = items[numItems++];
+                jsonString(body, "name", item.name, sizeof(item.name));
+                jsonString(body, "expiry_date", item.expiry, sizeof(item.expiry));
+                item.quantity = jsonInt(body, "quantity");
+            }
+            request[headerLen + bodyLen] = saved;
+            ok = respond(fd, 201, "{\"ok\":true}", 11);
+        } else {
+            ok = respond(fd, 404, "{}", 2);
+        }
+        if (!ok) return;
+
+        // Keep any pipelined bytes
+        size_t used = headerLen + bodyLen;
+        memmove(request, request + used, have - used);
+        have -= used;
+        request[have] = '\0';
+    }
+}
+
+uint16_t mockServerStart(int count) {
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    if (listener < 0) return 0;
+
+    int one = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+    socklen_t addrLen = sizeof(addr);
+    if (bind(listener, (struct sockaddr*)&addr, sizeof(addr)) != 0 ||
+        listen(listener, 4) != 0 ||
+        getsockname(listener, (struct sockaddr*)&addr, &addrLen) != 0) {
+        close(listener);
+        return 0;
+    }
+
+    fflush(stdout);
+    serverPid = fork();
+    if (serverPid < 0) {
+        close(listener);
+        return 0;
+    }
+
+    if (serverPid == 0) {
+        seedItems(count);
+        for (;;) {
+            int fd = accept(listener, nullptr, nullptr);
+            if (fd < 0) continue;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+            serveConnection(fd);
+            close(fd);
+        }
+    }
+
+    close(listener);
+    return ntohs(addr.sin_port);
+}
+
+void mockServerStop() {
+    if (serverPid > 0) {
+        kill(serverPid, SIGTERM);
+        waitpid(serverPid, nullptr, 0);
+    }
+    serverPid = -1;
+}
@@ -0,0 +1,20 @@
+/*
+ * Mock inventory API for the Linux simulator
+ *
+ * Serves GET/POST /api/ingredients over plain HTTP/1.1 with keep-alive
+ * (the list chunked, everything else with Content-Length),
+ * from a forked child process so the app's blocking client can talk to it.
+ */
+
+#ifndef MOCK_SERVER_H
+#define MOCK_SERVER_H
+
+#include <stdint.h>
+
+// Start the server on a free localhost port with numItems seeded ingredients
+// Returns the port, or 0 on failure
+uint16_t mockServerStart(int numItems);
+
+void mockServerStop();
+
+#endif // MOCK_SERVER_H
@@ -0,0 +1,71 @@
+/*
+ * Arduino core and SPIFFS shims for the Linux simulator
+ *
+ * Kept apart from hal_sim.cpp so the host unit tests can link the shared
+ * modules without the simulated board.
+ */
+
+#include <Arduino.h>
+#include <SPIFFS.h>
+#include "sim_clock.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+// ---- Arduino core subset ----
+
+SimSerial Serial;
+static bool serialEnabled = true;
+
+void simSerialEnable(bool enabled) {
+    serialEnabled = enabled;
+}
+
+bool simSerialEnabled() {
+    return serialEnabled;
+}
+
+unsigned long millis() {
+    return (unsigned long)(simNowUs() / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)simNowUs();
+}
+
+void delay(unsigned long ms) {
+    simAdvance(STAGE_WAIT, (uint64_t)ms * 1000);
+}
+
+// ---- SPIFFS on a host directory ----
+
+SimSPIFFS SPIFFS;
+
+void SimSPIFFS::setRoot(const char* dir) {
+    strlcpy(root, dir, sizeof(root));
+}
+
+bool SimSPIFFS::begin(bool formatOnFail) {
+    struct stat st;
+    if (stat(root, &st) == 0) return S_ISDIR(st.st_mode);
+    return formatOnFail && mkdir(root, 0755) == 0;
+}
+
+const char* SimSPIFFS::hostPath(const char* path) {
+    snprintf(pathBuffer, sizeof(pathBuffer), "%s%s%s", root, path[0] == '/' ? "" : "/", path);
+    return pathBuffer;
+}
+
+File SimSPIFFS::open(const char* path, const char* mode) {
+    const char* fopenMode = strcmp(mode, FILE_WRITE) == 0 ? "wb" :
+                            strcmp(mode, FILE_APPEND) == 0 ? "ab" : "rb";
+    return File(fopen(hostPath(path), fopenMode));
+}
+
+bool SimSPIFFS::exists(const char* path) {
+    return access(hostPath(path), F_OK) == 0;
+}
+
+bool SimSPIFFS::remove(const char* path) {
+    return unlink(hostPath(path)) == 0;
+}
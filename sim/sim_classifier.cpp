@@ -0,0 +1,224 @@
+/*
+ * Stand-in for the TFLite classifier in the Linux simulator
+ *
+ * Implements the vegetable_classifier.h API with a colour heuristic so the
+ * app's scan flows can run end to end, and charges the device's model init
+ * and Invoke() cost to the virtual clock. The embedding is a colour
+ * histogram, which is enough to exercise kNN enrolment.
+ */
+
+#include "vegetable_classifier.h"
+#include "model_manager.h"
+#include "sim_clock.h"
+
+#define SIM_EMBEDDING_DIM 32
+#define SIM_HUE_BINS 16
+#define SIM_VALUE_BINS 8
+#define SIM_SAT_BINS 8
+
+static bool modelReady = false;
+static uint64_t readyAtUs = 0;
+static float lastProbabilities[NUM_CLASSES];
+static int8_t lastEmbedding[SIM_EMBEDDING_DIM];
+static bool lastEmbeddingValid = false;
+
+// Reference hue (degrees) per class, none has no hue
+static const float CLASS_HUES[NUM_CLASSES] = {
+    290.0f,   // eggplant
+    52.0f,    // lemon
+    120.0f,   // cucumber
+    4.0f,     // tomato
+    30.0f,    // onion
+    -1.0f     // none
+};
+
+static void rgbToHsv(const uint8_t* p, float& h, float& s, float& v) {
+    float r = p[0] / 255.0f, g = p[1] / 255.0f, b = p[2] / 255.0f;
+    float maxC = fmaxf(r, fmaxf(g, b));
+    float minC = fminf(r, fminf(g, b));
+    float d = maxC - minC;
+
+    v = maxC;
+    s = maxC > 0.0f ? d / maxC : 0.0f;
+    if (d <= 0.0f) {
+        h = 0.0f;
+    } else if (maxC == r) {
+        h = 60.0f * fmodf((g - b) / d + 6.0f, 6.0f);
+    } else if (maxC == g) {
+        h = 60.0f * ((b - r) / d + 2.0f);
+    } else {
+        h = 60.0f * ((r - g) / d + 4.0f);
+    }
+}
+
+static float hueDistance(float a, float b) {
+    float d = fabsf(a - b);
+    return d > 180.0f ? 360.0f - d : d;
+}
+
+// Classify one region and (optionally) build its embedding
+static ClassificationResult classifyRegion(const uint8_t* imageData, int width,
+                                           const ImageRegion& r, float* probabilities,
+                                           int8_t* embedding) {
+    float histogram[SIM_EMBEDDING_DIM] = {0};
+    float hueX = 0.0f, hueY = 0.0f;
+    int colored = 0, total = 0;
+
+    // Every 4th pixel is plenty for a heuristic
+    for (int y = r.y; y < r.y + r.height; y += 4) {
+        for (int x = r.x; x < r.x + r.width; x += 4) {
+            float h, s, v;
+            rgbToHsv(imageData + (y * width + x) * 3, h, s, v);
+            total++;
+
+            histogram[SIM_HUE_BINS + min((int)(v * SIM_VALUE_BINS), SIM_VALUE_BINS - 1)] += 1.0f;
+            histogram[SIM_HUE_BINS + SIM_VALUE_BINS + min((int)(s * SIM_SAT_BINS), SIM_SAT_BINS - 1)] += 1.0f;
+
+            if (s > 0.35f && v > 0.2f) {
+                colored++;
+                histogram[(int)(h / 360.0f * SIM_HUE_BINS) % SIM_HUE_BINS] += 1.0f;
+                hueX += cosf(h * (float)M_PI / 180.0f);
+                hueY += sinf(h * (float)M_PI / 180.0f);
+            }
+        }
+    }
+
+    float coverage = total > 0 ? (float)colored / total : 0.0f;
+    float hue = atan2f(hueY, hueX) * 180.0f / (float)M_PI;
+    if (hue < 0.0f) hue += 360.0f;
+
+    // Score classes by hue closeness, "none" by lack of colour
+    float sum = 0.0f;
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        float score;
+        if (i == NONE_CLASS_INDEX) {
+            score = expf((0.15f - coverage) * 20.0f);
+        } else {
+            float d = hueDistance(hue, CLASS_HUES[i]);
+            score = coverage > 0.05f ? expf(-d * d / 200.0f) * coverage * 10.0f : 0.0f;
+        }
+        probabilities[i] = score;
+        sum += score;
+    }
+    int best = 0;
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        probabilities[i] = sum > 0.0f ? probabilities[i] / sum : 1.0f / NUM_CLASSES;
+        if (probabilities[i] > probabilities[best]) best = i;
+    }
+
+    if (embedding != nullptr) {
+        float norm = 0.0f;
+        for (int i = 0; i < SIM_EMBEDDING_DIM; i++) norm += histogram[i] * histogram[i];
+        norm = norm > 0.0f ? sqrtf(norm) : 1.0f;
+        for (int i = 0; i < SIM_EMBEDDING_DIM; i++) {
+            embedding[i] = (int8_t)lroundf(histogram[i] / norm * 127.0f);
+        }
+    }
+
+    ClassificationResult result = {best, VEGETABLE_LABELS[best], probabilities[best], true};
+    return result;
+}
+
+bool classifierRegister() {
+    return true;
+}
+
+// Stands in for model_manager.cpp: the device's AllocateTensors() cost
+bool modelManagerBegin() {
+    simAdvance(STAGE_INFERENCE, SIM_MODEL_INIT_US);
+    return true;
+}
+
+bool classifierInit() {
+    readyAtUs = simNowUs();
+    modelReady = true;
+    Serial.println("Classifier ready (simulated)");
+    return true;
+}
+
+ClassificationResult classifyImage(uint8_t* imageData, int width, int height) {
+    ClassificationResult result = {-1, "unknown", 0.0f, false};
+    clearLastEmbedding();
+    if (!isModelReady()) {
+        Serial.println("Classifier not initialized!");
+        return result;
+    }
+
+    simAdvance(STAGE_INFERENCE, SIM_INVOKE_US);
+
+    ImageRegion fullFrame = {0, 0, width, height};
+    result = classifyRegion(imageData, width, fullFrame, lastProbabilities, lastEmbedding);
+    lastEmbeddingValid = true;
+
+    Serial.printf("Result: %s (%.1f%%)\n", result.className, result.confidence * 100);
+    return result;
+}
+
+bool classifyRegions(uint8_t* imageData, int width, int height,
+                     const ImageRegion* regions, int numRegions,
+                     float minConfidence, MultiScanResult& out) {
+    out.numRegions = 0;
+    out.totalItems = 0;
+    out.valid = false;
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        out.itemCounts[i] = 0;
+    }
+    clearLastEmbedding();
+
+    if (!isModelReady()) {
+        Serial.println("Classifier not initialized!");
+        return false;
+    }
+
+    if (numRegions > MAX_SCAN_REGIONS) numRegions = MAX_SCAN_REGIONS;
+
+    for (int i = 0; i < numRegions; i++) {
+        ImageRegion r = regions[i];
+        if (r.x < 0) { r.width += r.x; r.x = 0; }
+        if (r.y < 0) { r.height += r.y; r.y = 0; }
+        if (r.x + r.width > width) r.width = width - r.x;
+        if (r.y + r.height > height) r.height = height - r.y;
+        if (r.width < 1 || r.height < 1) {
+            Serial.printf("Region %d is outside the image\n", i);
+            return false;
+        }
+        out.regions[i] = r;
+
+        // The shipped model has batch size 1: one Invoke() per region
+        simAdvance(STAGE_INFERENCE, SIM_INVOKE_US);
+        float probabilities[NUM_CLASSES];
+        out.results[i] = classifyRegion(imageData, width, r, probabilities, nullptr);
+        Serial.printf("  region %d: %s (%.1f%%)\n",
+                      i, out.results[i].className, out.results[i].confidence * 100);
+    }
+    out.numRegions = numRegions;
+
+    countScanItems(out, minConfidence);
+    out.valid = true;
+    return true;
+}
+
+void getClassProbabilities(float* probabilities) {
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        probabilities[i] = lastProbabilities[i];
+    }
+}
+
+void clearLastEmbedding() {
+    lastEmbeddingValid = false;
+}
+
+int getLastEmbedding(int8_t* embedding) {
+    if (!lastEmbeddingValid) return 0;
+    memcpy(embedding, lastEmbedding, SIM_EMBEDDING_DIM);
+    return SIM_EMBEDDING_DIM;
+}
+
+int getEmbeddingDim() {
+    return SIM_EMBEDDING_DIM;
+}
+
+// Ready once the background init would have finished on the device
+bool isModelReady() {
+    return modelReady && simNowUs() >= readyAtUs;
+}
@@ -0,0 +1,55 @@
+/*
+ * Simulator virtual clock implementation
+ */
+
+#include "sim_clock.h"
+#include <string.h>
+#include <time.h>
+
+static uint64_t nowUs = 0;
+static uint64_t stageUs[STAGE_COUNT];
+
+static const char* STAGE_NAMES[STAGE_COUNT] = {
+    "display", "camera", "inference", "network", "wait"
+};
+
+// Process CPU time
+static uint64_t hostCpuUs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+uint64_t simNowUs() {
+    return nowUs;
+}
+
+void simAdvance(SimStage stage, uint64_t us) {
+    nowUs += us;
+    stageUs[stage] += us;
+}
+
+const uint64_t* simStageTotals() {
+    return stageUs;
+}
+
+const char* simStageName(int stage) {
+    return stage >= 0 && stage < STAGE_COUNT ? STAGE_NAMES[stage] : "?";
+}
+
+uint64_t simRunLane(void (*fn)(void*), void* param) {
+    uint64_t savedNow = nowUs;
+    uint64_t savedStages[STAGE_COUNT];
+    memcpy(savedStages, stageUs, sizeof(stageUs));
+
+    fn(param);
+
+    uint64_t laneUs = nowUs - savedNow;
+    nowUs = savedNow;
+    memcpy(stageUs, savedStages, sizeof(stageUs));
+    return laneUs;
+}
+
+uint64_t simHostCpuUs() {
+    return hostCpuUs();
+}
@@ -0,0 +1,62 @@
+/*
+ * Simulator virtual clock
+ *
+ * All time in the simulator is virtual: millis()/delay() and every HAL call
+ * advance a single deterministic clock by a modelled cost, attributed to a
+ * stage so a workflow's latency can be broken down. Host CPU time spent in
+ * app code is measured separately and not added to the clock.
+ */
+
+#ifndef SIM_CLOCK_H
+#define SIM_CLOCK_H
+
+#include <stdint.h>
+
+// Where virtual time goes
+enum SimStage {
+    STAGE_DISPLAY,      // Canvas drawing and screen flushes
+    STAGE_CAMERA,       // Frame capture
+    STAGE_INFERENCE,    // Model init and Invoke()
+    STAGE_NETWORK,      // Connect, round trips, transfer
+    STAGE_WAIT,         // delay() in app code
+    STAGE_COUNT
+};
+
+// ---- Cost model (calibrate against device logs) ----
+#define SIM_TEXT_US_PER_CHAR 120        // canvasText glyph rendering
+#define SIM_TEXT_CALL_US 400            // canvasText fixed overhead
+#define SIM_RECT_US_PER_KPIXEL 40       // Filled rectangle
+#define SIM_BLIT_US_PER_KPIXEL 50       // RGB565 block copy into the canvas (PSRAM)
+#define SIM_CLEAR_US 2000               // canvasClear
+#define SIM_FLUSH_US 31000              // updateCanvas: 240x320x2 bytes over SPI
+#define SIM_CAMERA_INIT_US 450000
+#define SIM_CAPTURE_US 70000
+#define SIM_MODEL_INIT_US 1800000       // PSRAM arena + AllocateTensors
+#define SIM_INVOKE_US 12000000          // One Invoke() (~12 s on the K10)
+#define SIM_WIFI_CONNECT_US 2500000
+#define SIM_NTP_SYNC_US 900000
+#define SIM_TLS_CONNECT_US 650000       // TCP + TLS handshake
+#define SIM_RTT_US 90000                // Request round trip
+#define SIM_NET_US_PER_KB 8000          // Transfer time
+
+// Current virtual time
+uint64_t simNowUs();
+
+// Advance the clock, attributing the time to a stage
+void simAdvance(SimStage stage, uint64_t us);
+
+// Virtual time per stage since start (foreground only)
+const uint64_t* simStageTotals();
+
+const char* simStageName(int stage);
+
+// Run fn(param) as a parallel lane starting now: it sees the clock advance
+// as it runs, but afterwards the clock and stage totals are restored.
+// Returns the virtual time the lane took.
+uint64_t simRunLane(void (*fn)(void*), void* param);
+
+// Host CPU time used by the process so far, microseconds (real work only:
+// modelled costs advance the virtual clock, not the CPU)
+uint64_t simHostCpuUs();
+
+#endif // SIM_CLOCK_H
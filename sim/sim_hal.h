@@ -0,0 +1,39 @@
+/*
+ * Simulator controls beyond hal.h (used by sim_main.cpp)
+ */
+
+#ifndef SIM_HAL_H
+#define SIM_HAL_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Draw calls recorded by the fake display
+struct SimDisplayStats {
+    long clears;       // halDisplayClear
+    long lineClears;   // halDisplayClearLine
+    long rects;        // halDisplayRect
+    long texts;        // halDisplayText / halDisplayTextLine
+    long textChars;    // Characters drawn
+    long blits;        // halDisplayBlit
+    long blitPixels;   // Pixels copied by halDisplayBlit
+    long updates;      // halDisplayUpdate (screen flushes)
+};
+
+const SimDisplayStats& simDisplayStats();
+
+// Simulated canvas (240x320 RGB565), holds the pixels of halDisplayBlit()
+const uint16_t* simDisplayPixels();
+
+// Write every draw call to log ("t=<ms> <call> <args>"), nullptr to stop
+void simDisplaySetLog(FILE* log);
+
+// Load camera frames (*.rgb565, raw 320x240 little-endian) from dir,
+// played back in name order. Without frames a synthetic scene is generated.
+// Returns number of frames loaded
+int simCameraLoadFrames(const char* dir);
+
+// Virtual time taken by the last background task (halStartTask)
+uint64_t simLastTaskUs();
+
+#endif // SIM_HAL_H
@@ -0,0 +1,316 @@
+/*
+ * Linux simulator for the fridge app
+ *
+ * Runs fridge_app.cpp unmodified against hal_sim.cpp: a scripted sequence
+ * of button presses drives the app on a virtual clock, the inventory API is
+ * a local mock server, and every workflow (boot, button press, refresh) is
+ * reported with its virtual latency broken down by stage.
+ *
+ * Usage: fridge_sim [options]
+ *   --script LIST     Comma-separated events: A, B, AB, wait:<ms>
+ *   --frames DIR      Camera frames (*.rgb565, 320x240), default synthetic
+ *   --data DIR        Directory standing in for SPIFFS (default sim_data)
+ *   --items N         Ingredients served by the mock API (default 12)
+ *   --soak N          Run N inventory refresh cycles, fail if any allocates
+ *   --max-scan-ms MS  Fail if a scan (B in scanner) takes longer than MS
+ *   --bench-list      Inventory render time per frame for 5, 50 and 500 rows
+ *   --display-log F   Write every draw call to file F
+ *   --quiet           Hide app Serial output
+ */
+
+#include <Arduino.h>
+#include <SPIFFS.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "fridge_app.h"
+#include "heap_monitor.h"
+#include "mock_server.h"
+#include "sim_clock.h"
+#include "sim_hal.h"
+
+#define DEFAULT_SCRIPT "wait:8000,B,A,AB,B,AB,B,A,wait:35000"
+#define SOAK_WARMUP_CYCLES 2
+#define REFRESH_INTERVAL_MS 30000
+
+struct Options {
+    const char* script = DEFAULT_SCRIPT;
+    const char* framesDir = nullptr;
+    const char* dataDir = "sim_data";
+    int items = 12;
+    int soakCycles = 0;
+    long maxScanMs = 0;
+    const char* displayLog = nullptr;
+    bool quiet = false;
+    bool benchList = false;
+};
+
+// Where one workflow started
+struct Mark {
+    uint64_t virtualUs;
+    uint64_t stageUs[STAGE_COUNT];
+    uint64_t cpuUs;
+};
+
+static int failures = 0;
+
+static Mark markNow() {
+    Mark m;
+    m.virtualUs = simNowUs();
+    memcpy(m.stageUs, simStageTotals(), sizeof(m.stageUs));
+    m.cpuUs = simHostCpuUs();
+    return m;
+}
+
+// Print one workflow: total virtual time, per-stage split, host CPU
+// Returns the virtual time in ms
+static uint64_t report(const char* name, const Mark& start) {
+    uint64_t totalUs = simNowUs() - start.virtualUs;
+    const uint64_t* stages = simStageTotals();
+
+    printf("%-22s %9.1f ms  [", name, totalUs / 1000.0);
+    for (int i = 0; i < STAGE_COUNT; i++) {
+        printf("%s%s %.1f", i > 0 ? ", " : "", simStageName(i), (stages[i] - start.stageUs[i]) / 1000.0);
+    }
+    printf("]  host cpu %.2f ms\n", (simHostCpuUs() - start.cpuUs) / 1000.0);
+    return totalUs / 1000;
+}
+
+static bool parseOptions(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        bool takesValue = strcmp(arg, "--quiet") != 0 && strcmp(arg, "--bench-list") != 0;
+
+        if (takesValue && value == nullptr) {
+            fprintf(stderr, "%s needs a value\n", arg);
+            return false;
+        }
+
+        if (strcmp(arg, "--script") == 0) opt.script = value;
+        else if (strcmp(arg, "--frames") == 0) opt.framesDir = value;
+        else if (strcmp(arg, "--data") == 0) opt.dataDir = value;
+        else if (strcmp(arg, "--items") == 0) opt.items = atoi(value);
+        else if (strcmp(arg, "--soak") == 0) opt.soakCycles = atoi(value);
+        else if (strcmp(arg, "--max-scan-ms") == 0) opt.maxScanMs = atol(value);
+        else if (strcmp(arg, "--display-log") == 0) opt.displayLog = value;
+        else if (strcmp(arg, "--quiet") == 0) opt.quiet = true;
+        else if (strcmp(arg, "--bench-list") == 0) opt.benchList = true;
+        else {
+            fprintf(stderr, "Unknown option %s\n", arg);
+            return false;
+        }
+
+        if (takesValue) i++;
+    }
+    return true;
+}
+
+// Run the main loop until the virtual clock reaches untilUs
+static void runLoopUntil(uint64_t untilUs) {
+    while (simNowUs() < untilUs) {
+        appLoop();
+    }
+}
+
+static void runScript(const Options& opt) {
+    static char script[512];
+    strlcpy(script, opt.script, sizeof(script));
+
+    bool inScanner = false;
+    char* save = nullptr;
+    for (char* event = strtok_r(script, ",", &save); event != nullptr; event = strtok_r(nullptr, ",", &save)) {
+        if (strncmp(event, "wait:", 5) == 0) {
+            runLoopUntil(simNowUs() + (uint64_t)atol(event + 5) * 1000);
+            continue;
+        }
+
+        // Let the loop run once so background state settles, as between real presses
+        appLoop();
+
+        const char* name;
+        Mark start = markNow();
+        if (strcmp(event, "A") == 0) {
+            appButtonA();
+            name = inScanner ? "button A (back)" : "button A (scroll up)";
+            inScanner = false;
+        } else if (strcmp(event, "B") == 0) {
+            appButtonB();
+            name = inScanner ? "button B (scan)" : "button B (scroll down)";
+        } else if (strcmp(event, "AB") == 0) {
+            appButtonAB();
+            name = inScanner ? "button A+B (mode)" : "button A+B (scanner)";
+            inScanner = true;
+        } else {
+            fprintf(stderr, "Unknown script event %s\n", event);
+            failures++;
+            continue;
+        }
+        uint64_t ms = report(name, start);
+
+        if (strcmp(event, "B") == 0 && inScanner && opt.maxScanMs > 0 && (long)ms > opt.maxScanMs) {
+            printf("FAIL: scan took %llu ms (limit %ld ms)\n", (unsigned long long)ms, opt.maxScanMs);
+            failures++;
+        }
+    }
+}
+
+// Refresh cycles in inventory mode must not touch the heap after warm-up
+static void runSoak(const Options& opt) {
+    uint32_t lastCycle = heapMonitorLast().cycle;
+    int refreshes = 0;
+
+    while (refreshes < opt.soakCycles) {
+        Mark start = markNow();
+        runLoopUntil(simNowUs() + REFRESH_INTERVAL_MS * 1000ULL + 200000);
+
+        const HeapStats& stats = heapMonitorLast();
+        if (stats.cycle == lastCycle || strcmp(stats.cycleName, "refresh") != 0) continue;
+        lastCycle = stats.cycle;
+        refreshes++;
+
+        if (!opt.quiet || refreshes == opt.soakCycles) {
+            char name[32];
+            snprintf(name, sizeof(name), "refresh #%d", refreshes);
+            report(name, start);
+        }
+
+        if (refreshes > SOAK_WARMUP_CYCLES && (stats.allocCount != 0 || stats.blockDelta != 0)) {
+            printf("FAIL: refresh #%d made %ld allocations (%+d blocks kept)\n",
+                   refreshes, stats.allocCount, stats.blockDelta);
+            failures++;
+        }
+    }
+    printf("Soak: %d refresh cycles, worst largest free block %u bytes\n",
+           refreshes, (unsigned)heapMonitorWorstLargestBlock());
+}
+
+// One list benchmark run: boot with rows ingredients, then time the full
+// inventory redraw (back from the scanner) and scrolling to the end.
+// Runs in a child process so every size starts from a fresh app.
+static void benchListRows(const Options& opt, int rows) {
+    char dataDir[256];
+    snprintf(dataDir, sizeof(dataDir), "%s/bench_%d", opt.dataDir, rows);
+    mkdir(dataDir, 0755);
+    SPIFFS.setRoot(dataDir);
+    SPIFFS.remove("/inventory.txt");
+
+    uint16_t port = mockServerStart(rows);
+    static char url[64];
+    snprintf(url, sizeof(url), "http://127.0.0.1:%u/api", port);
+    serverUrl = url;
+
+    simSerialEnable(false);
+    appSetup();
+    runLoopUntil(simNowUs() + 10000000);
+    appButtonAB();  // Into the scanner, so A redraws the whole inventory
+
+    // Full redraw
+    const SimDisplayStats& display = simDisplayStats();
+    Mark start = markNow();
+    long flushes = display.updates;
+    appButtonA();
+    double redrawMs = (simNowUs() - start.virtualUs) / 1000.0;
+    double redrawCpuMs = (simHostCpuUs() - start.cpuUs) / 1000.0;
+    long redrawFrames = display.updates - flushes;
+
+    // Scroll down to the last row, one row per press
+    start = markNow();
+    flushes = display.updates;
+    int presses = 0;
+    while (presses < rows) {
+        long before = display.updates;
+        appButtonB();
+        if (display.updates == before) break;  // At the end
+        presses++;
+    }
+    long scrollFrames = display.updates - flushes;
+    uint64_t scrollUs = simNowUs() - start.virtualUs;
+    uint64_t scrollCpuUs = simHostCpuUs() - start.cpuUs;
+
+    printf("%5d rows  redraw: %ld frame, %6.2f ms (host %.3f ms)", rows, redrawFrames, redrawMs, redrawCpuMs);
+    if (scrollFrames > 0) {
+        printf("  scroll: %3d rows in %4ld frames, %6.2f ms/frame (host %.3f ms/frame)\n",
+               presses, scrollFrames, scrollUs / 1000.0 / scrollFrames, scrollCpuUs / 1000.0 / scrollFrames);
+    } else {
+        printf("  scroll: fits on screen\n");
+    }
+    mockServerStop();
+}
+
+static int runListBenchmark(const Options& opt) {
+    static const int SIZES[] = {5, 50, 500};
+
+    printf("Inventory list render (virtual time incl. %.1f ms screen flush per frame)\n",
+           SIM_FLUSH_US / 1000.0);
+    for (int rows : SIZES) {
+        fflush(stdout);
+        pid_t pid = fork();
+        if (pid == 0) {
+            benchListRows(opt, rows);
+            fflush(stdout);
+            _exit(0);
+        }
+        int status = 0;
+        waitpid(pid, &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) failures++;
+    }
+    return failures > 0 ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseOptions(argc, argv, opt)) return 2;
+
+    mkdir(opt.dataDir, 0755);
+    if (opt.benchList) return runListBenchmark(opt);
+
+    simSerialEnable(!opt.quiet);
+    SPIFFS.setRoot(opt.dataDir);
+
+    FILE* displayLog = nullptr;
+    if (opt.displayLog != nullptr) {
+        displayLog = fopen(opt.displayLog, "w");
+        simDisplaySetLog(displayLog);
+    }
+
+    if (opt.framesDir != nullptr) {
+        printf("Loaded %d camera frames from %s\n", simCameraLoadFrames(opt.framesDir), opt.framesDir);
+    }
+
+    uint16_t port = mockServerStart(opt.items);
+    if (port == 0) {
+        fprintf(stderr, "Could not start mock server\n");
+        return 2;
+    }
+    static char url[64];
+    snprintf(url, sizeof(url), "http://127.0.0.1:%u/api", port);
+    serverUrl = url;
+
+    Mark start = markNow();
+    appSetup();
+    report("boot (first frame)", start);
+    printf("%-22s %9.1f ms  (background)\n", "classifier init", simLastTaskUs() / 1000.0);
+
+    if (opt.soakCycles > 0) {
+        runLoopUntil(simNowUs() + 10000000);
+        runSoak(opt);
+    } else {
+        runScript(opt);
+    }
+
+    const SimDisplayStats& display = simDisplayStats();
+    printf("Display: %ld flushes, %ld clears, %ld line clears, %ld rects, %ld texts (%ld chars), %ld blits\n",
+           display.updates, display.clears, display.lineClears, display.rects,
+           display.texts, display.textChars, display.blits);
+    printf("Virtual time %.1f s, host cpu %.1f ms\n", simNowUs() / 1e6, simHostCpuUs() / 1000.0);
+
+    mockServerStop();
+    if (displayLog != nullptr) fclose(displayLog);
+
+    if (failures > 0) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,362 @@
+/*
+ * API Client Implementation
+ */
+
+#include "api_client.h"
+#include "hal.h"
+
+// Connection (the stream itself lives in the HAL)
+static char apiHost[API_HOST_MAX];
+static char apiPrefix[API_PREFIX_MAX];
+static uint16_t apiPort = 443;
+static bool apiSecure = true;
+
+// Current response
+static char lineBuffer[API_LINE_MAX];
+static bool bodyChunked = false;
+static bool bodyUntilClose = false; // No length given: body ends when the server closes
+static long bodyRemaining = 0;     // Bytes left in body (or current chunk)
+static bool bodyDone = true;
+static int bodyPeeked = -1;        // Character read ahead by peek()
+static bool closeAfterResponse = false;
+static ApiBodyReader bodyReader;
+
+// readLine() failures
+#define LINE_CLOSED -1     // Connection closed before any byte of the line
+#define LINE_TIMEOUT -2    // Nothing arrived within API_TIMEOUT_MS
+
+// sendOnce() failures
+#define SEND_UNANSWERED -1 // Write failed or closed before any response byte: safe to resend
+#define SEND_TOO_LONG -2   // Request head does not fit lineBuffer
+#define SEND_FAILED -3     // Timeout or broken response, the server may have acted on it
+
+// Read one line (without CRLF) into lineBuffer, discarding overflow
+// HTTP lines end in CRLF, so even a blank line reads at least the '\r'
+// Returns line length, LINE_CLOSED or LINE_TIMEOUT
+static int readLine() {
+    size_t len = halNetReadUntil('\n', lineBuffer, API_LINE_MAX - 1, API_TIMEOUT_MS);
+    if (len == 0) return halNetConnected() ? LINE_TIMEOUT : LINE_CLOSED;
+
+    // Line longer than the buffer: drop the rest of it
+    if (len == API_LINE_MAX - 1) {
+        char c;
+        while (halNetRead(&c, 1, API_TIMEOUT_MS) == 1 && c != '\n') {
+        }
+    }
+
+    if (len > 0 && lineBuffer[len - 1] == '\r') len--;
+    lineBuffer[len] = '\0';
+    return (int)len;
+}
+
+// Stop reading a body that broke off, the connection is unusable
+static void abortBody() {
+    bodyDone = true;
+    closeAfterResponse = true;
+}
+
+// Read the size line of the next chunk
+static void startChunk() {
+    if (readLine() < 0) {
+        abortBody();
+        return;
+    }
+    bodyRemaining = strtol(lineBuffer, nullptr, 16);
+    if (bodyRemaining == 0) {
+        readLine();  // Empty trailer line
+        bodyDone = true;
+    }
+}
+
+int ApiBodyReader::read() {
+    char c;
+    return readBytes(&c, 1) == 1 ? (uint8_t)c : -1;
+}
+
+int ApiBodyReader::peek() {
+    if (bodyPeeked < 0) {
+        char c;
+        if (readBytes(&c, 1) == 1) bodyPeeked = (uint8_t)c;
+    }
+    return bodyPeeked;
+}
+
+size_t ApiBodyReader::readBytes(char* buffer, size_t length) {
+    size_t total = 0;
+
+    if (bodyPeeked >= 0 && length > 0) {
+        buffer[total++] = (char)bodyPeeked;
+        bodyPeeked = -1;
+    }
+
+    while (total < length && !bodyDone) {
+        if (!bodyUntilClose && bodyRemaining == 0) {
+            if (!bodyChunked) {
+                bodyDone = true;
+                break;
+            }
+            startChunk();
+            continue;
+        }
+
+        size_t want = length - total;
+        if (!bodyUntilClose && (long)want > bodyRemaining) want = bodyRemaining;
+
+        size_t got = halNetRead(buffer + total, want, API_TIMEOUT_MS);
+        total += got;
+        if (got < want && bodyUntilClose) {
+            // Server closed: that was the end of the body
+            abortBody();
+            break;
+        }
+        if (got == 0) {
+            // Timeout or connection dropped mid-body
+            abortBody();
+            break;
+        }
+        if (bodyUntilClose) continue;
+        bodyRemaining -= got;
+
+        if (bodyChunked && bodyRemaining == 0 && readLine() < 0) {
+            abortBody();  // No CRLF after chunk data
+        }
+    }
+    return total;
+}
+
+bool apiClientBegin(const char* baseUrl) {
+    const char* host = strstr(baseUrl, "://");
+    apiSecure = host == nullptr || strncmp(baseUrl, "https", 5) == 0;
+    apiPort = apiSecure ? 443 : 80;
+    host = host ? host + 3 : baseUrl;
+
+    const char* prefix = strchr(host, '/');
+    size_t hostLen = prefix ? (size_t)(prefix - host) : strlen(host);
+    if (hostLen >= API_HOST_MAX) {
+        Serial.println("API host name too long");
+        return false;
+    }
+
+    memcpy(apiHost, host, hostLen);
+    apiHost[hostLen] = '\0';
+    strlcpy(apiPrefix, prefix ? prefix : "", API_PREFIX_MAX);
+
+    char* port = strchr(apiHost, ':');
+    if (port != nullptr) {
+        *port = '\0';
+        apiPort = atoi(port + 1);
+    }
+    return true;
+}
+
+// Write request and parse status line + headers on the current connection
+static int sendOnce(const char* method, const char* path, const char* body, size_t bodyLen) {
+    int headLen = snprintf(lineBuffer, API_LINE_MAX,
+                           "%s %s%s HTTP/1.1\r\n"
+                           "Host: %s\r\n"
+                           "Connection: keep-alive\r\n"
+                           "Accept: application/json\r\n",
+                           method, apiPrefix, path, apiHost);
+    if (body != nullptr && headLen > 0 && headLen < API_LINE_MAX) {
+        headLen += snprintf(lineBuffer + headLen, API_LINE_MAX - headLen,
+                            "Content-Type: application/json\r\n"
+                            "Content-Length: %u\r\n",
+                            (unsigned)bodyLen);
+    }
+    if (headLen <= 0 || headLen + 2 >= API_LINE_MAX) {
+        Serial.println("API request head too long");
+        return SEND_TOO_LONG;
+    }
+    strcpy(lineBuffer + headLen, "\r\n");
+    headLen += 2;
+
+    if (halNetWrite((const uint8_t*)lineBuffer, headLen) != (size_t)headLen) return SEND_UNANSWERED;
+    if (body != nullptr && halNetWrite((const uint8_t*)body, bodyLen) != bodyLen) return SEND_UNANSWERED;
+
+    // Status line: "HTTP/1.1 200 OK"
+    int statusLen = readLine();
+    if (statusLen == LINE_CLOSED) return SEND_UNANSWERED;
+    if (statusLen <= 0) return SEND_FAILED;
+    int status = 0;
+    if (sscanf(lineBuffer, "HTTP/%*s %d", &status) != 1) return SEND_FAILED;
+
+    // Headers
+    bodyChunked = false;
+    bodyUntilClose = false;
+    bodyRemaining = 0;
+    bodyPeeked = -1;
+    closeAfterResponse = false;
+    bool hasLength = false;
+    while (true) {
+        int len = readLine();
+        if (len < 0) return SEND_FAILED;
+        if (len == 0) break;
+
+        if (strncasecmp(lineBuffer, "Content-Length:", 15) == 0) {
+            bodyRemaining = atol(lineBuffer + 15);
+            hasLength = true;
+        } else if (strncasecmp(lineBuffer, "Transfer-Encoding:", 18) == 0) {
+            bodyChunked = strstr(lineBuffer + 18, "chunked") != nullptr;
+        } else if (strncasecmp(lineBuffer, "Connection:", 11) == 0) {
+            closeAfterResponse = strstr(lineBuffer + 11, "close") != nullptr;
+        }
+    }
+
+    bodyDone = false;
+    if (status == 204 || status == 304) {
+        bodyDone = true;    // Never have a body
+    } else if (bodyChunked) {
+        bodyRemaining = 0;  // First chunk size is read on demand
+    } else if (!hasLength) {
+        bodyUntilClose = true;
+        closeAfterResponse = true;
+    } else if (bodyRemaining == 0) {
+        bodyDone = true;
+    }
+    return status;
+}
+
+void apiLock() {
+    halNetLock();
+}
+
+void apiUnlock() {
+    halNetUnlock();
+}
+
+int apiRequest(const char* method, const char* path, const char* body, size_t bodyLen) {
+    // A reused connection may have been closed by the server while idle,
+    // so retry once on a fresh connection. Only a request that got no
+    // response at all is resent: after a timeout or a partial response the
+    // server may already have acted on it (a POST would add the item twice).
+    for (int attempt = 0; attempt < 2; attempt++) {
+        bool reused = halNetConnected();
+        if (!reused && !halNetConnect(apiHost, apiPort, apiSecure)) {
+            Serial.println("Failed to connect to API server");
+            return -1;
+        }
+
+        int status = sendOnce(method, path, body, bodyLen);
+        if (status > 0) return status;
+
+        halNetStop();
+        bodyDone = true;
+        if (!reused || status != SEND_UNANSWERED) return status;
+    }
+    return -1;
+}
+
+ApiBodyReader& apiResponseBody() {
+    return bodyReader;
+}
+
+void apiEndRequest() {
+    char drain[64];
+    while (!bodyDone) {
+        bodyReader.readBytes(drain, sizeof(drain));
+    }
+    if (closeAfterResponse) {
+        halNetStop();
+    }
+}
+
+// JsonDocument memory: bump allocator over a static arena. Each block is
+// prefixed with its size so the last block can be grown or shrunk in place.
+class ArenaAllocator : public ArduinoJson::Allocator {
+public:
+    void* allocate(size_t size) override {
+        size_t need = align(size) + HEADER;
+        if (used + need > API_JSON_ARENA_SIZE) {
+            Serial.printf("JSON arena full (%u + %u bytes)\n", (unsigned)used, (unsigned)need);
+            return nullptr;
+        }
+        uint8_t* block = arena + used;
+        *(size_t*)block = size;
+        last = block + HEADER;
+        used += need;
+        if (used > peak) peak = used;
+        return last;
+    }
+
+    void deallocate(void* ptr) override {
+        // Only the most recent block can be returned to the arena
+        if (ptr != nullptr && ptr == last) {
+            used = (uint8_t*)ptr - HEADER - arena;
+            last = nullptr;
+        }
+    }
+
+    void* reallocate(void* ptr, size_t newSize) override {
+        if (ptr == nullptr) return allocate(newSize);
+
+        size_t oldSize = *(size_t*)((uint8_t*)ptr - HEADER);
+        if (ptr == last) {
+            size_t start = (uint8_t*)ptr - arena;
+            if (start + align(newSize) > API_JSON_ARENA_SIZE) return nullptr;
+            *(size_t*)((uint8_t*)ptr - HEADER) = newSize;
+            used = start + align(newSize);
+            if (used > peak) peak = used;
+            return ptr;
+        }
+
+        void* block = allocate(newSize);
+        if (block != nullptr) {
+            memcpy(block, ptr, oldSize < newSize ? oldSize : newSize);
+        }
+        return block;
+    }
+
+    void reset() {
+        used = 0;
+        last = nullptr;
+    }
+
+    size_t mark() const {
+        return used;
+    }
+
+    void release(size_t mark) {
+        if (mark < used) {
+            used = mark;
+            last = nullptr;
+        }
+    }
+
+    size_t peakBytes() const {
+        return peak;
+    }
+
+private:
+    static const size_t HEADER = sizeof(size_t) > 8 ? sizeof(size_t) : 8;
+
+    static size_t align(size_t size) {
+        return (size + 7) & ~(size_t)7;
+    }
+
+    alignas(8) uint8_t arena[API_JSON_ARENA_SIZE];
+    size_t used = 0;
+    size_t peak = 0;
+    uint8_t* last = nullptr;
+};
+
+static ArenaAllocator jsonArena;
+
+ArduinoJson::Allocator* apiJsonAllocator() {
+    return &jsonArena;
+}
+
+void apiJsonReset() {
+    jsonArena.reset();
+}
+
+size_t apiJsonMark() {
+    return jsonArena.mark();
+}
+
+void apiJsonRelease(size_t mark) {
+    jsonArena.release(mark);
+}
+
+size_t apiJsonArenaPeak() {
+    return jsonArena.peakBytes();
+}
@@ -0,0 +1,74 @@
+/*
+ * API Client
+ *
+ * Minimal HTTP/1.1 client for the inventory API.
+ * Keeps one connection open (keep-alive, TLS for https URLs) over the HAL
+ * network stream and uses fixed buffers, so a request/response cycle does
+ * not allocate once the connection is up.
+ * HTTPClient is not used because it builds a String for the URL and for
+ * every response header line.
+ */
+
+#ifndef API_CLIENT_H
+#define API_CLIENT_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Buffer sizes
+#define API_HOST_MAX 64          // Host name from the base URL
+#define API_PREFIX_MAX 64        // Path prefix from the base URL (e.g. "/api")
+#define API_LINE_MAX 256         // Request head / response header line
+#define API_JSON_ARENA_SIZE (12 * 1024)  // JsonDocument memory per request
+
+#define API_TIMEOUT_MS 15000
+
+// Reader over the current response body (Content-Length, chunked, or
+// until the server closes the connection)
+// Implements read()/readBytes() so it can be passed to deserializeJson()
+class ApiBodyReader {
+public:
+    int read();
+    int peek();      // Next character without consuming it (-1 at end)
+    size_t readBytes(char* buffer, size_t length);
+};
+
+// Parse base URL ("http[s]://host[:port]/prefix"), call once in setup
+bool apiClientBegin(const char* baseUrl);
+
+// The connection, buffers and JSON arena are shared by the main loop and the
+// boot fetch task. Hold the lock across a whole request, from building its
+// JSON documents to apiEndRequest() and apiJsonReset().
+void apiLock();
+void apiUnlock();
+
+// Send a request and read the response status line and headers
+// path: appended to the base URL prefix (e.g. "/ingredients")
+// body: request body (JSON) or nullptr
+// Returns HTTP status code, or negative on connection/protocol error
+int apiRequest(const char* method, const char* path, const char* body, size_t bodyLen);
+
+// Body of the response to the last apiRequest()
+ApiBodyReader& apiResponseBody();
+
+// Finish the current response (drain unread body, close if server asked to)
+void apiEndRequest();
+
+// Allocator for JsonDocuments used by API requests
+// Bump allocator over a static arena, reset with apiJsonReset()
+ArduinoJson::Allocator* apiJsonAllocator();
+
+// Release all JsonDocument memory (call after the documents are destroyed)
+void apiJsonReset();
+
+// Current arena position, to release later documents with apiJsonRelease()
+// (used to parse a long array one element at a time in constant memory)
+size_t apiJsonMark();
+
+// Release everything allocated after mark (those documents must be destroyed)
+void apiJsonRelease(size_t mark);
+
+// Peak arena usage in bytes since boot
+size_t apiJsonArenaPeak();
+
+#endif // API_CLIENT_H
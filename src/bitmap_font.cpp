@@ -0,0 +1,1151 @@
+/*
+ * Built-in bitmap font data (see bitmap_font.h)
+ *
+ * Rasterized from DejaVuSansMono.ttf at 18px into 11x22 cells, 4-bit
+ * coverage. DejaVu fonts: Bitstream Vera license, free to embed.
+ */
+
+#include "bitmap_font.h"
+
+const uint8_t FONT_COVERAGE[FONT_NUM_GLYPHS * FONT_GLYPH_BYTES] = {
+    // 32 ' '
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 33 '!'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 34 '"'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0x80, 0xAD, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xAD, 0x00, 0x00,
+    0x00, 0x0F, 0x80, 0xAD, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xAD, 0x00, 0x00,
+    0x00, 0x0F, 0x80, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 35 '#'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x00, 0xE7, 0x00,
+    0x00, 0x00, 0xBA, 0x03, 0xF3, 0x00, 0x00, 0x00, 0xE7, 0x06, 0xF0, 0x00,
+    0x00, 0x03, 0xF3, 0x0A, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0C, 0x90, 0x4F, 0x20, 0x00,
+    0x00, 0x3F, 0x30, 0x9C, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xD9, 0x04, 0xF2, 0x00, 0x00,
+    0x01, 0xF5, 0x07, 0xE0, 0x00, 0x00, 0x04, 0xF2, 0x0B, 0xA0, 0x00, 0x00,
+    0x08, 0xD0, 0x0E, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 36 '$'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x18, 0xDF, 0xEA, 0x30, 0x00,
+    0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFB, 0x2C, 0x35, 0xB0, 0x00,
+    0x04, 0xF5, 0x0C, 0x10, 0x00, 0x00, 0x01, 0xE9, 0x0C, 0x10, 0x00, 0x00,
+    0x00, 0x5E, 0xDE, 0x72, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xDF, 0x90, 0x00,
+    0x00, 0x00, 0x0C, 0x14, 0xF7, 0x00, 0x00, 0x00, 0x0C, 0x10, 0xEB, 0x00,
+    0x05, 0x93, 0x1C, 0x27, 0xFA, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xF3, 0x00,
+    0x00, 0x5B, 0xDF, 0xEA, 0x30, 0x00, 0x00, 0x00, 0x0C, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 37 '%'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xDE, 0x80, 0x00, 0x00, 0x00, 0x4E, 0x32, 0xC7, 0x00, 0x00, 0x00,
+    0x99, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x98, 0x00, 0x6C, 0x00, 0x00, 0x00,
+    0x4E, 0x32, 0xC7, 0x00, 0x16, 0x00, 0x06, 0xDE, 0x81, 0x6B, 0xD9, 0x10,
+    0x00, 0x15, 0xAD, 0x94, 0x00, 0x00, 0x1A, 0xD9, 0x41, 0xAE, 0xC4, 0x00,
+    0x04, 0x00, 0x0A, 0xB1, 0x5E, 0x20, 0x00, 0x00, 0x0F, 0x30, 0x0B, 0x70,
+    0x00, 0x00, 0x0F, 0x30, 0x0B, 0x70, 0x00, 0x00, 0x0A, 0xB1, 0x5E, 0x20,
+    0x00, 0x00, 0x01, 0xAE, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 38 '&'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x19, 0xDF, 0xFA, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFA, 0x00, 0x00,
+    0x00, 0xDD, 0x20, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0x70, 0x00, 0x00, 0x00, 0x01, 0xCD, 0xF5, 0x00, 0x00, 0x00,
+    0x0B, 0xB0, 0xAE, 0x30, 0x0D, 0x80, 0x3F, 0x30, 0x1C, 0xD2, 0x0E, 0x70,
+    0x7F, 0x20, 0x02, 0xEC, 0x3F, 0x30, 0x7F, 0x60, 0x00, 0x3F, 0xEB, 0x00,
+    0x3F, 0xE7, 0x21, 0x4D, 0xF6, 0x00, 0x08, 0xFF, 0xFF, 0xFD, 0xCD, 0x10,
+    0x00, 0x6C, 0xFE, 0x91, 0x5F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 39 '''
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 40 '('
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x1E, 0x90, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 41 ')'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 42 '*'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x04, 0x91, 0x1E, 0x02, 0xB2, 0x00,
+    0x02, 0xAD, 0x5E, 0x5E, 0x91, 0x00, 0x00, 0x05, 0xDF, 0xC3, 0x00, 0x00,
+    0x00, 0x04, 0xDF, 0xC3, 0x00, 0x00, 0x01, 0xAD, 0x5E, 0x5E, 0x81, 0x00,
+    0x04, 0x91, 0x1E, 0x02, 0xB2, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 43 '+'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+    0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 44 ','
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x01, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 45 '-'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x0D, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 46 '.'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 47 '/'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE1, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0x70, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x10, 0x00, 0x00,
+    0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x00,
+    0x00, 0x1E, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x30, 0x00, 0x00, 0x00,
+    0x01, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 48 '0'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0xDF, 0xD6, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0x70, 0x00,
+    0x03, 0xFE, 0x40, 0x5F, 0xE1, 0x00, 0x08, 0xF6, 0x00, 0x08, 0xF5, 0x00,
+    0x0A, 0xF2, 0x00, 0x04, 0xF8, 0x00, 0x0C, 0xF0, 0x7E, 0x52, 0xF9, 0x00,
+    0x0C, 0xE0, 0x8E, 0x52, 0xFA, 0x00, 0x0C, 0xF0, 0x00, 0x02, 0xF9, 0x00,
+    0x0A, 0xF2, 0x00, 0x04, 0xF8, 0x00, 0x08, 0xF6, 0x00, 0x08, 0xF5, 0x00,
+    0x03, 0xFE, 0x30, 0x5F, 0xE1, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0x70, 0x00,
+    0x00, 0x08, 0xDF, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 49 '1'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x27, 0xCF, 0xD0, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xD0, 0x00, 0x00,
+    0x00, 0xB8, 0x3D, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xF9, 0x00,
+    0x00, 0x9F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 50 '2'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x7C, 0xEE, 0xC5, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+    0x07, 0x93, 0x11, 0x7F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF3, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x80, 0x00,
+    0x00, 0x00, 0x01, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xC1, 0x00, 0x00,
+    0x00, 0x02, 0xDC, 0x10, 0x00, 0x00, 0x00, 0x2D, 0xB1, 0x00, 0x00, 0x00,
+    0x03, 0xEB, 0x10, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xF5, 0x00,
+    0x0A, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 51 '3'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5B, 0xEE, 0xC5, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+    0x06, 0x94, 0x11, 0x4E, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF2, 0x00,
+    0x00, 0x00, 0x01, 0x5E, 0xD0, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x20, 0x00,
+    0x00, 0x08, 0xFF, 0xFB, 0x20, 0x00, 0x00, 0x00, 0x01, 0x5E, 0xE1, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF7, 0x00,
+    0x0A, 0x73, 0x11, 0x5E, 0xF4, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xB0, 0x00,
+    0x02, 0x8C, 0xEE, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 52 '4'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0C, 0xEF, 0x40, 0x00,
+    0x00, 0x00, 0x6C, 0x8F, 0x40, 0x00, 0x00, 0x02, 0xE3, 0x8F, 0x40, 0x00,
+    0x00, 0x0A, 0x80, 0x8F, 0x40, 0x00, 0x00, 0x5D, 0x10, 0x8F, 0x40, 0x00,
+    0x01, 0xD4, 0x00, 0x8F, 0x40, 0x00, 0x09, 0xA0, 0x00, 0x8F, 0x40, 0x00,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 53 '5'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+    0x03, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFD, 0xEE, 0xB5, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+    0x03, 0x93, 0x12, 0x8F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF4, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF4, 0x00,
+    0x09, 0x62, 0x02, 0x7F, 0xE1, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+    0x02, 0x9D, 0xFE, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 54 '6'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xBE, 0xEA, 0x20, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xB0, 0x00,
+    0x01, 0xEF, 0x82, 0x04, 0x80, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xE1, 0xAE, 0xEA, 0x20, 0x00,
+    0x0C, 0xCC, 0xFF, 0xFF, 0xD1, 0x00, 0x0C, 0xFC, 0x30, 0x2B, 0xF7, 0x00,
+    0x0A, 0xF3, 0x00, 0x03, 0xFA, 0x00, 0x08, 0xF3, 0x00, 0x03, 0xF9, 0x00,
+    0x03, 0xFC, 0x30, 0x2B, 0xF7, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xD1, 0x00,
+    0x00, 0x08, 0xDF, 0xEA, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 55 '7'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xF3, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x20, 0x00, 0x00,
+    0x00, 0x01, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x0D, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 56 '8'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2A, 0xDF, 0xD8, 0x10, 0x00, 0x02, 0xEF, 0xFF, 0xFF, 0xD0, 0x00,
+    0x07, 0xFA, 0x20, 0x3C, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x07, 0xF5, 0x00,
+    0x03, 0xFA, 0x20, 0x3C, 0xE1, 0x00, 0x00, 0x4C, 0xFF, 0xFB, 0x30, 0x00,
+    0x00, 0x6E, 0xFF, 0xFD, 0x50, 0x00, 0x05, 0xFA, 0x20, 0x3C, 0xF3, 0x00,
+    0x0B, 0xF1, 0x00, 0x03, 0xF9, 0x00, 0x0C, 0xF1, 0x00, 0x03, 0xFA, 0x00,
+    0x0A, 0xFA, 0x20, 0x3C, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE1, 0x00,
+    0x00, 0x2A, 0xDF, 0xD9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 57 '9'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3B, 0xEF, 0xC6, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+    0x0A, 0xF9, 0x11, 0x4E, 0xE1, 0x00, 0x0D, 0xE0, 0x00, 0x07, 0xF5, 0x00,
+    0x0D, 0xE0, 0x00, 0x07, 0xF7, 0x00, 0x0A, 0xF8, 0x11, 0x4D, 0xF8, 0x00,
+    0x03, 0xFF, 0xFF, 0xF9, 0xF9, 0x00, 0x00, 0x4B, 0xEE, 0x93, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00,
+    0x00, 0xA3, 0x12, 0xAF, 0xC0, 0x00, 0x00, 0xEF, 0xFF, 0xFE, 0x30, 0x00,
+    0x00, 0x4B, 0xEE, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 58 ':'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 59 ';'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x01, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 60 '<'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x10,
+    0x00, 0x00, 0x02, 0x8E, 0xFD, 0x10, 0x00, 0x05, 0xBF, 0xE9, 0x40, 0x00,
+    0x18, 0xEF, 0xC6, 0x10, 0x00, 0x00, 0x3F, 0xE5, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0xEF, 0xB6, 0x10, 0x00, 0x00, 0x00, 0x05, 0xBF, 0xE9, 0x40, 0x00,
+    0x00, 0x00, 0x02, 0x8E, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 61 '='
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 62 '>'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x2E, 0xFD, 0x72, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xA4, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0xDF, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x10,
+    0x00, 0x00, 0x17, 0xCF, 0xD7, 0x00, 0x00, 0x4A, 0xFF, 0xA4, 0x00, 0x00,
+    0x2E, 0xFD, 0x82, 0x00, 0x00, 0x00, 0x3B, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 63 '?'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x29, 0xDE, 0xD8, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0x90, 0x00,
+    0x00, 0xA6, 0x21, 0x5E, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0x00,
+    0x00, 0x00, 0x00, 0x1E, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xCE, 0x30, 0x00,
+    0x00, 0x00, 0x1C, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0x10, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 64 '@'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBE, 0xEC, 0x70, 0x00,
+    0x00, 0x8E, 0x61, 0x14, 0xDB, 0x00, 0x06, 0xE2, 0x00, 0x00, 0x2F, 0x30,
+    0x1E, 0x60, 0x19, 0xED, 0x9E, 0x50, 0x5E, 0x00, 0xAC, 0x22, 0xBF, 0x50,
+    0x9B, 0x02, 0xF4, 0x00, 0x2F, 0x50, 0xB9, 0x05, 0xF1, 0x00, 0x0E, 0x50,
+    0xB8, 0x05, 0xF1, 0x00, 0x0E, 0x50, 0xA9, 0x02, 0xF4, 0x00, 0x2F, 0x50,
+    0x8C, 0x00, 0xAC, 0x22, 0xBF, 0x50, 0x5F, 0x10, 0x19, 0xED, 0x8E, 0x50,
+    0x0D, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5E, 0x93, 0x10, 0x00, 0x00, 0x00, 0x02, 0x8D, 0xEF, 0xC1, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 65 'A'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0xA0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xE0, 0x00, 0x00,
+    0x00, 0x06, 0xF7, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xD1, 0xF9, 0x00, 0x00,
+    0x00, 0x1F, 0x80, 0xBD, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x7F, 0x30, 0x00,
+    0x00, 0xAE, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xEA, 0x00, 0x0D, 0xC0, 0x00,
+    0x04, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xF6, 0x00,
+    0x0D, 0xE0, 0x00, 0x02, 0xFB, 0x00, 0x3F, 0x90, 0x00, 0x00, 0xCF, 0x10,
+    0x8F, 0x50, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 66 'B'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0xFF, 0xFF, 0xD9, 0x20, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xE1, 0x00,
+    0x08, 0xF4, 0x00, 0x2A, 0xF6, 0x00, 0x08, 0xF4, 0x00, 0x05, 0xF7, 0x00,
+    0x08, 0xF4, 0x00, 0x2B, 0xF4, 0x00, 0x08, 0xFF, 0xFF, 0xFD, 0x70, 0x00,
+    0x08, 0xFF, 0xFF, 0xFE, 0x80, 0x00, 0x08, 0xF4, 0x00, 0x29, 0xF7, 0x00,
+    0x08, 0xF4, 0x00, 0x00, 0xED, 0x00, 0x08, 0xF4, 0x00, 0x00, 0xDF, 0x00,
+    0x08, 0xF4, 0x00, 0x28, 0xFD, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xF5, 0x00,
+    0x08, 0xFF, 0xFF, 0xEB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 67 'C'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x9D, 0xFD, 0x81, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xF7, 0x00,
+    0x00, 0xDF, 0x92, 0x02, 0x86, 0x00, 0x05, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xDF, 0x92, 0x02, 0x76, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xF7, 0x00,
+    0x00, 0x02, 0x9D, 0xFD, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 68 'D'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0xED, 0x82, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFE, 0x30, 0x00,
+    0x0C, 0xF0, 0x13, 0xAF, 0xD0, 0x00, 0x0C, 0xF0, 0x00, 0x0B, 0xF5, 0x00,
+    0x0C, 0xF0, 0x00, 0x06, 0xF8, 0x00, 0x0C, 0xF0, 0x00, 0x03, 0xFA, 0x00,
+    0x0C, 0xF0, 0x00, 0x03, 0xFB, 0x00, 0x0C, 0xF0, 0x00, 0x03, 0xFA, 0x00,
+    0x0C, 0xF0, 0x00, 0x05, 0xF8, 0x00, 0x0C, 0xF0, 0x00, 0x0B, 0xF5, 0x00,
+    0x0C, 0xF0, 0x13, 0xAF, 0xD0, 0x00, 0x0C, 0xFF, 0xFF, 0xFE, 0x30, 0x00,
+    0x0C, 0xFF, 0xED, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 69 'E'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+    0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
+    0x04, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFA, 0x00,
+    0x04, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 70 'F'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xEF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xF3, 0x00,
+    0x00, 0xEF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 71 'G'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xBE, 0xEC, 0x60, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00,
+    0x03, 0xFE, 0x61, 0x13, 0x93, 0x00, 0x0A, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xEF, 0xFB, 0x00,
+    0x1F, 0xB0, 0x00, 0xEF, 0xFB, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFB, 0x00,
+    0x0E, 0xE0, 0x00, 0x00, 0xFB, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0xFB, 0x00,
+    0x03, 0xFE, 0x61, 0x14, 0xFB, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF5, 0x00,
+    0x00, 0x05, 0xBE, 0xEB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 72 'H'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0xF0, 0x00, 0x02, 0xFA, 0x00, 0x0C, 0xF0, 0x00, 0x02, 0xFA, 0x00,
+    0x0C, 0xF0, 0x00, 0x02, 0xFA, 0x00, 0x0C, 0xF0, 0x00, 0x02, 0xFA, 0x00,
+    0x0C, 0xF0, 0x00, 0x02, 0xFA, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFA, 0x00,
+    0x0C, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x0C, 0xF0, 0x00, 0x02, 0xFA, 0x00,
+    0x0C, 0xF0, 0x00, 0x02, 0xFA, 0x00, 0x0C, 0xF0, 0x00, 0x02, 0xFA, 0x00,
+    0x0C, 0xF0, 0x00, 0x02, 0xFA, 0x00, 0x0C, 0xF0, 0x00, 0x02, 0xFA, 0x00,
+    0x0C, 0xF0, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 73 'I'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xF1, 0x00,
+    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xF1, 0x00,
+    0x04, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 74 'J'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00,
+    0x1B, 0x52, 0x03, 0xDF, 0x30, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
+    0x04, 0xAD, 0xFE, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 75 'K'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0xF0, 0x00, 0x01, 0xDE, 0x30, 0x0C, 0xF0, 0x00, 0x1C, 0xE3, 0x00,
+    0x0C, 0xF0, 0x01, 0xCE, 0x40, 0x00, 0x0C, 0xF0, 0x1C, 0xF4, 0x00, 0x00,
+    0x0C, 0xF1, 0xBF, 0x50, 0x00, 0x00, 0x0C, 0xFB, 0xFB, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0xCF, 0x50, 0x00, 0x00, 0x0C, 0xF6, 0x1E, 0xE1, 0x00, 0x00,
+    0x0C, 0xF0, 0x05, 0xFA, 0x00, 0x00, 0x0C, 0xF0, 0x00, 0xAF, 0x60, 0x00,
+    0x0C, 0xF0, 0x00, 0x1E, 0xE2, 0x00, 0x0C, 0xF0, 0x00, 0x05, 0xFB, 0x00,
+    0x0C, 0xF0, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 76 'L'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 77 'M'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xF5, 0x00, 0x07, 0xFF, 0x10, 0x4F, 0xEA, 0x00, 0x0D, 0xEF, 0x10,
+    0x4F, 0x9E, 0x10, 0x3F, 0xAF, 0x10, 0x4F, 0x6D, 0x60, 0x9A, 0x9F, 0x10,
+    0x4F, 0x68, 0xB0, 0xE5, 0x9F, 0x10, 0x4F, 0x62, 0xF6, 0xE0, 0x9F, 0x10,
+    0x4F, 0x60, 0xCE, 0x90, 0x9F, 0x10, 0x4F, 0x60, 0x7F, 0x40, 0x9F, 0x10,
+    0x4F, 0x60, 0x00, 0x00, 0x9F, 0x10, 0x4F, 0x60, 0x00, 0x00, 0x9F, 0x10,
+    0x4F, 0x60, 0x00, 0x00, 0x9F, 0x10, 0x4F, 0x60, 0x00, 0x00, 0x9F, 0x10,
+    0x4F, 0x60, 0x00, 0x00, 0x9F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 78 'N'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0xFA, 0x00, 0x01, 0xF9, 0x00, 0x0C, 0xFF, 0x20, 0x01, 0xF9, 0x00,
+    0x0C, 0xEE, 0x80, 0x01, 0xF9, 0x00, 0x0C, 0xE9, 0xE0, 0x01, 0xF9, 0x00,
+    0x0C, 0xE2, 0xF5, 0x01, 0xF9, 0x00, 0x0C, 0xE0, 0xBB, 0x01, 0xF9, 0x00,
+    0x0C, 0xE0, 0x5F, 0x21, 0xF9, 0x00, 0x0C, 0xE0, 0x0D, 0x91, 0xF9, 0x00,
+    0x0C, 0xE0, 0x08, 0xE2, 0xF9, 0x00, 0x0C, 0xE0, 0x02, 0xF8, 0xF9, 0x00,
+    0x0C, 0xE0, 0x00, 0xAD, 0xF9, 0x00, 0x0C, 0xE0, 0x00, 0x4F, 0xF9, 0x00,
+    0x0C, 0xE0, 0x00, 0x0D, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 79 'O'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0xDF, 0xD7, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x90, 0x00,
+    0x05, 0xFD, 0x30, 0x4E, 0xF2, 0x00, 0x0A, 0xF4, 0x00, 0x07, 0xF7, 0x00,
+    0x0D, 0xF1, 0x00, 0x03, 0xFA, 0x00, 0x0E, 0xE0, 0x00, 0x01, 0xFC, 0x00,
+    0x0E, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x0E, 0xE0, 0x00, 0x01, 0xFC, 0x00,
+    0x0D, 0xF1, 0x00, 0x03, 0xFA, 0x00, 0x0A, 0xF4, 0x00, 0x07, 0xF7, 0x00,
+    0x05, 0xFD, 0x30, 0x4E, 0xF2, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0x90, 0x00,
+    0x00, 0x19, 0xDF, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 80 'P'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xFF, 0xEB, 0x40, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
+    0x04, 0xF8, 0x00, 0x29, 0xFC, 0x00, 0x04, 0xF8, 0x00, 0x00, 0xEF, 0x00,
+    0x04, 0xF8, 0x00, 0x00, 0xEF, 0x00, 0x04, 0xF8, 0x00, 0x29, 0xFC, 0x00,
+    0x04, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x04, 0xFF, 0xFF, 0xEB, 0x40, 0x00,
+    0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 81 'Q'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0xDF, 0xD7, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x90, 0x00,
+    0x05, 0xFD, 0x30, 0x4E, 0xF3, 0x00, 0x0A, 0xF4, 0x00, 0x07, 0xF7, 0x00,
+    0x0D, 0xF1, 0x00, 0x03, 0xFA, 0x00, 0x0E, 0xE0, 0x00, 0x01, 0xFC, 0x00,
+    0x0E, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x0E, 0xE0, 0x00, 0x01, 0xFB, 0x00,
+    0x0D, 0xF1, 0x00, 0x03, 0xFA, 0x00, 0x0A, 0xF4, 0x00, 0x07, 0xF6, 0x00,
+    0x05, 0xFD, 0x30, 0x4E, 0xF2, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x70, 0x00,
+    0x00, 0x19, 0xEF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 82 'R'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xFE, 0xC6, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xA0, 0x00,
+    0x0B, 0xF1, 0x01, 0x6F, 0xF2, 0x00, 0x0B, 0xF1, 0x00, 0x09, 0xF5, 0x00,
+    0x0B, 0xF1, 0x00, 0x09, 0xF4, 0x00, 0x0B, 0xF1, 0x01, 0x5E, 0xE1, 0x00,
+    0x0B, 0xFF, 0xFF, 0xFD, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xF7, 0x00, 0x00,
+    0x0B, 0xF1, 0x02, 0xBF, 0x50, 0x00, 0x0B, 0xF1, 0x00, 0x1E, 0xD0, 0x00,
+    0x0B, 0xF1, 0x00, 0x06, 0xF7, 0x00, 0x0B, 0xF1, 0x00, 0x00, 0xDE, 0x10,
+    0x0B, 0xF1, 0x00, 0x00, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 83 'S'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x29, 0xDF, 0xD9, 0x20, 0x00, 0x02, 0xEF, 0xFF, 0xFF, 0xD0, 0x00,
+    0x09, 0xFA, 0x30, 0x26, 0xB0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x84, 0x10, 0x00, 0x00,
+    0x00, 0x3A, 0xEF, 0xFB, 0x20, 0x00, 0x00, 0x00, 0x03, 0x7D, 0xE2, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x00,
+    0x08, 0x83, 0x11, 0x3C, 0xF7, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xE1, 0x00,
+    0x01, 0x7C, 0xEF, 0xD9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 84 'T'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x60,
+    0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 85 'U'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xF1, 0x00, 0x04, 0xF8, 0x00, 0x0B, 0xF1, 0x00, 0x04, 0xF8, 0x00,
+    0x0B, 0xF1, 0x00, 0x04, 0xF8, 0x00, 0x0B, 0xF1, 0x00, 0x04, 0xF8, 0x00,
+    0x0B, 0xF1, 0x00, 0x04, 0xF8, 0x00, 0x0B, 0xF1, 0x00, 0x04, 0xF8, 0x00,
+    0x0B, 0xF1, 0x00, 0x04, 0xF8, 0x00, 0x0B, 0xF1, 0x00, 0x04, 0xF8, 0x00,
+    0x0A, 0xF1, 0x00, 0x04, 0xF8, 0x00, 0x09, 0xF2, 0x00, 0x05, 0xF7, 0x00,
+    0x06, 0xFB, 0x31, 0x3D, 0xF4, 0x00, 0x01, 0xDF, 0xFF, 0xFF, 0xB0, 0x00,
+    0x00, 0x19, 0xEF, 0xD8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 86 'V'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5F, 0x70, 0x00, 0x00, 0xAF, 0x30, 0x1F, 0xB0, 0x00, 0x00, 0xED, 0x00,
+    0x0B, 0xF1, 0x00, 0x03, 0xF9, 0x00, 0x07, 0xF4, 0x00, 0x07, 0xF5, 0x00,
+    0x03, 0xF8, 0x00, 0x0B, 0xF1, 0x00, 0x00, 0xDC, 0x00, 0x0E, 0xB0, 0x00,
+    0x00, 0x9F, 0x10, 0x4F, 0x60, 0x00, 0x00, 0x4F, 0x50, 0x8F, 0x20, 0x00,
+    0x00, 0x0E, 0x90, 0xCC, 0x00, 0x00, 0x00, 0x0A, 0xD1, 0xF8, 0x00, 0x00,
+    0x00, 0x06, 0xF7, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 87 'W'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEC, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0xCE, 0x00, 0x00, 0x00, 0x1F, 0x90,
+    0x9F, 0x00, 0x00, 0x00, 0x3F, 0x70, 0x7F, 0x20, 0x00, 0x00, 0x5F, 0x50,
+    0x5F, 0x40, 0x9F, 0x70, 0x6F, 0x20, 0x3F, 0x60, 0xDF, 0xA0, 0x8F, 0x00,
+    0x0F, 0x71, 0xF9, 0xE0, 0xAD, 0x00, 0x0D, 0x95, 0xE2, 0xF2, 0xCB, 0x00,
+    0x0B, 0xB8, 0xB0, 0xD5, 0xE8, 0x00, 0x09, 0xDB, 0x70, 0xA9, 0xF6, 0x00,
+    0x06, 0xEE, 0x40, 0x6E, 0xF4, 0x00, 0x04, 0xFF, 0x00, 0x2F, 0xF1, 0x00,
+    0x02, 0xFB, 0x00, 0x0E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 88 'X'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0xD1, 0x00, 0x00, 0xCE, 0x20, 0x05, 0xF8, 0x00, 0x06, 0xF6, 0x00,
+    0x00, 0xAF, 0x20, 0x1E, 0xC0, 0x00, 0x00, 0x2E, 0xB0, 0x9F, 0x20, 0x00,
+    0x00, 0x07, 0xF8, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xA0, 0x00, 0x00, 0x00, 0x05, 0xFC, 0xF5, 0x00, 0x00,
+    0x00, 0x1E, 0xD1, 0xCD, 0x10, 0x00, 0x00, 0x9F, 0x40, 0x4F, 0x80, 0x00,
+    0x04, 0xF9, 0x00, 0x0A, 0xF2, 0x00, 0x0D, 0xE1, 0x00, 0x02, 0xFB, 0x00,
+    0x8F, 0x60, 0x00, 0x00, 0x8F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 89 'Y'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0x70, 0x00, 0x00, 0xAF, 0x30, 0x0C, 0xE1, 0x00, 0x03, 0xF9, 0x00,
+    0x03, 0xF9, 0x00, 0x0C, 0xE1, 0x00, 0x00, 0x9F, 0x30, 0x5F, 0x70, 0x00,
+    0x00, 0x1E, 0xB0, 0xDD, 0x00, 0x00, 0x00, 0x07, 0xFA, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0xDF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 90 'Z'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x05, 0xE2, 0x00, 0x00,
+    0x00, 0x00, 0x2E, 0x60, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
+    0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 91 '['
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 92 backslash
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x1E, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE1, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 93 ']'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 94 '^'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x08, 0xFB, 0xF6, 0x00, 0x00,
+    0x00, 0x5F, 0x70, 0x9F, 0x30, 0x00, 0x03, 0xE8, 0x00, 0x0B, 0xE1, 0x00,
+    0x1D, 0xA0, 0x00, 0x01, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 95 '_'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 96 '`'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x90, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 97 'a'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xDF, 0xC7, 0x00, 0x00,
+    0x02, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x02, 0xB5, 0x10, 0x3C, 0xF1, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x5B, 0xEF, 0xFF, 0xF4, 0x00,
+    0x05, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x0B, 0xE5, 0x10, 0x06, 0xF5, 0x00,
+    0x0B, 0xE3, 0x01, 0x5E, 0xF5, 0x00, 0x07, 0xFF, 0xFF, 0xF9, 0xF5, 0x00,
+    0x00, 0x7D, 0xFC, 0x55, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 98 'b'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF5, 0x7E, 0xEA, 0x10, 0x00,
+    0x04, 0xFA, 0xFF, 0xFF, 0xC0, 0x00, 0x04, 0xFE, 0x51, 0x3C, 0xF6, 0x00,
+    0x04, 0xF9, 0x00, 0x03, 0xFA, 0x00, 0x04, 0xF6, 0x00, 0x00, 0xFB, 0x00,
+    0x04, 0xF6, 0x00, 0x00, 0xFB, 0x00, 0x04, 0xF9, 0x00, 0x03, 0xFA, 0x00,
+    0x04, 0xFE, 0x51, 0x2C, 0xF5, 0x00, 0x04, 0xFA, 0xFF, 0xFF, 0xC0, 0x00,
+    0x04, 0xF5, 0x7E, 0xEA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 99 'c'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9D, 0xFD, 0x70, 0x00,
+    0x00, 0x3E, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0xCF, 0xA3, 0x12, 0x74, 0x00,
+    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xA3, 0x12, 0x74, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xF5, 0x00,
+    0x00, 0x02, 0x9D, 0xFD, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 100 'd'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x2B, 0xED, 0x67, 0xF2, 0x00,
+    0x01, 0xEF, 0xFF, 0xFA, 0xF2, 0x00, 0x08, 0xFA, 0x21, 0x7F, 0xF2, 0x00,
+    0x0C, 0xF1, 0x00, 0x0B, 0xF2, 0x00, 0x0D, 0xD0, 0x00, 0x08, 0xF2, 0x00,
+    0x0D, 0xD0, 0x00, 0x08, 0xF2, 0x00, 0x0C, 0xF1, 0x00, 0x0B, 0xF2, 0x00,
+    0x08, 0xFA, 0x21, 0x7F, 0xF2, 0x00, 0x01, 0xEF, 0xFF, 0xFA, 0xF2, 0x00,
+    0x00, 0x2B, 0xED, 0x67, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 101 'e'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xDF, 0xE9, 0x10, 0x00,
+    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFB, 0x30, 0x29, 0xF6, 0x00,
+    0x0B, 0xE1, 0x00, 0x00, 0xEA, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x0D, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xFA, 0x31, 0x14, 0x95, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF6, 0x00,
+    0x00, 0x07, 0xCF, 0xEB, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 102 'f'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xDF, 0xF5, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xF5, 0x00,
+    0x04, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 103 'g'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xED, 0x67, 0xF2, 0x00,
+    0x01, 0xDF, 0xFF, 0xFA, 0xF2, 0x00, 0x07, 0xFB, 0x21, 0x6F, 0xF2, 0x00,
+    0x0C, 0xF1, 0x00, 0x0B, 0xF2, 0x00, 0x0D, 0xD0, 0x00, 0x08, 0xF2, 0x00,
+    0x0D, 0xD0, 0x00, 0x08, 0xF2, 0x00, 0x0C, 0xF1, 0x00, 0x0B, 0xF2, 0x00,
+    0x07, 0xFB, 0x21, 0x6F, 0xF2, 0x00, 0x01, 0xDF, 0xFF, 0xFA, 0xF2, 0x00,
+    0x00, 0x2B, 0xED, 0x67, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00,
+    0x00, 0x95, 0x11, 0x6F, 0xB0, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0x40, 0x00,
+    0x00, 0x3A, 0xEE, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 104 'h'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF5, 0x5D, 0xFB, 0x10, 0x00,
+    0x04, 0xF9, 0xFF, 0xFF, 0xA0, 0x00, 0x04, 0xFE, 0x51, 0x3D, 0xF1, 0x00,
+    0x04, 0xF9, 0x00, 0x08, 0xF3, 0x00, 0x04, 0xF6, 0x00, 0x06, 0xF3, 0x00,
+    0x04, 0xF5, 0x00, 0x06, 0xF4, 0x00, 0x04, 0xF5, 0x00, 0x06, 0xF4, 0x00,
+    0x04, 0xF5, 0x00, 0x06, 0xF4, 0x00, 0x04, 0xF5, 0x00, 0x06, 0xF4, 0x00,
+    0x04, 0xF5, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 105 'i'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x60, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0x60, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF9, 0x00,
+    0x07, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 106 'j'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xD0, 0x00, 0x00,
+    0x00, 0x8F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+    0x05, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 107 'k'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x00, 0x08, 0xF7, 0x00,
+    0x00, 0xEB, 0x00, 0x8F, 0x60, 0x00, 0x00, 0xEB, 0x08, 0xF6, 0x00, 0x00,
+    0x00, 0xEB, 0x9F, 0x60, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x90, 0x00, 0x00,
+    0x00, 0xEF, 0x49, 0xF5, 0x00, 0x00, 0x00, 0xEB, 0x01, 0xDE, 0x20, 0x00,
+    0x00, 0xEB, 0x00, 0x3F, 0xB0, 0x00, 0x00, 0xEB, 0x00, 0x07, 0xF7, 0x00,
+    0x00, 0xEB, 0x00, 0x00, 0xBF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 108 'l'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+    0x09, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xCE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF1, 0x00,
+    0x00, 0x00, 0x08, 0xEF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 109 'm'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x7C, 0xE4, 0x5E, 0xC2, 0x00,
+    0x1F, 0xEF, 0xFD, 0xEF, 0xFA, 0x00, 0x1F, 0xB1, 0x9F, 0x81, 0xCD, 0x00,
+    0x1F, 0x70, 0x5F, 0x40, 0x8E, 0x00, 0x1F, 0x60, 0x4F, 0x30, 0x8E, 0x00,
+    0x1F, 0x60, 0x4F, 0x30, 0x8F, 0x00, 0x1F, 0x60, 0x4F, 0x30, 0x8F, 0x00,
+    0x1F, 0x60, 0x4F, 0x30, 0x8F, 0x00, 0x1F, 0x60, 0x4F, 0x30, 0x8F, 0x00,
+    0x1F, 0x60, 0x4F, 0x30, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 110 'n'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF5, 0x5D, 0xFB, 0x10, 0x00,
+    0x04, 0xF9, 0xFF, 0xFF, 0xA0, 0x00, 0x04, 0xFE, 0x51, 0x3D, 0xF1, 0x00,
+    0x04, 0xF9, 0x00, 0x08, 0xF3, 0x00, 0x04, 0xF6, 0x00, 0x06, 0xF3, 0x00,
+    0x04, 0xF5, 0x00, 0x06, 0xF4, 0x00, 0x04, 0xF5, 0x00, 0x06, 0xF4, 0x00,
+    0x04, 0xF5, 0x00, 0x06, 0xF4, 0x00, 0x04, 0xF5, 0x00, 0x06, 0xF4, 0x00,
+    0x04, 0xF5, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 111 'o'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xEF, 0xD8, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0xFF, 0xA0, 0x00, 0x06, 0xFC, 0x31, 0x4D, 0xF3, 0x00,
+    0x0A, 0xF3, 0x00, 0x05, 0xF7, 0x00, 0x0C, 0xF0, 0x00, 0x02, 0xF9, 0x00,
+    0x0C, 0xF0, 0x00, 0x02, 0xF9, 0x00, 0x0A, 0xF3, 0x00, 0x05, 0xF7, 0x00,
+    0x06, 0xFC, 0x31, 0x4D, 0xF3, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xA0, 0x00,
+    0x00, 0x19, 0xEF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 112 'p'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x7E, 0xE9, 0x10, 0x00,
+    0x05, 0xFA, 0xFF, 0xFF, 0xC0, 0x00, 0x05, 0xFE, 0x51, 0x3C, 0xF5, 0x00,
+    0x05, 0xF8, 0x00, 0x03, 0xF9, 0x00, 0x05, 0xF5, 0x00, 0x00, 0xFB, 0x00,
+    0x05, 0xF5, 0x00, 0x00, 0xFB, 0x00, 0x05, 0xF8, 0x00, 0x03, 0xF9, 0x00,
+    0x05, 0xFE, 0x51, 0x3C, 0xF5, 0x00, 0x05, 0xFA, 0xFF, 0xFF, 0xC0, 0x00,
+    0x05, 0xF4, 0x8E, 0xEA, 0x10, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 113 'q'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xEE, 0x75, 0xF4, 0x00,
+    0x00, 0xCF, 0xFF, 0xFA, 0xF4, 0x00, 0x06, 0xFC, 0x21, 0x6F, 0xF4, 0x00,
+    0x0A, 0xF3, 0x00, 0x09, 0xF4, 0x00, 0x0C, 0xF0, 0x00, 0x06, 0xF4, 0x00,
+    0x0C, 0xF0, 0x00, 0x06, 0xF4, 0x00, 0x0A, 0xF3, 0x00, 0x09, 0xF4, 0x00,
+    0x06, 0xFC, 0x21, 0x6F, 0xF4, 0x00, 0x00, 0xDF, 0xFF, 0xFA, 0xF4, 0x00,
+    0x00, 0x2A, 0xEE, 0x75, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 114 'r'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x8E, 0xD8, 0x00,
+    0x00, 0x0C, 0xC8, 0xFF, 0xFF, 0x20, 0x00, 0x0C, 0xDD, 0x51, 0x28, 0x20,
+    0x00, 0x0C, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 115 's'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xDF, 0xD8, 0x10, 0x00,
+    0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFC, 0x30, 0x27, 0x70, 0x00,
+    0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xC8, 0x62, 0x00, 0x00,
+    0x00, 0x01, 0x58, 0xCF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
+    0x02, 0xB5, 0x20, 0x3D, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xA0, 0x00,
+    0x00, 0x4A, 0xEE, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 116 't'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xF6, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xF1, 0x00,
+    0x0D, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x03, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xFB, 0x10, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00,
+    0x00, 0x00, 0x3B, 0xEF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 117 'u'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF5, 0x00, 0x06, 0xF4, 0x00,
+    0x04, 0xF5, 0x00, 0x06, 0xF4, 0x00, 0x04, 0xF5, 0x00, 0x06, 0xF4, 0x00,
+    0x04, 0xF5, 0x00, 0x06, 0xF4, 0x00, 0x04, 0xF5, 0x00, 0x06, 0xF4, 0x00,
+    0x04, 0xF5, 0x00, 0x07, 0xF4, 0x00, 0x04, 0xF7, 0x00, 0x0A, 0xF4, 0x00,
+    0x01, 0xFD, 0x31, 0x6E, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xF9, 0xF4, 0x00,
+    0x00, 0x2B, 0xFD, 0x56, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 118 'v'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xB0, 0x00, 0x00, 0xDC, 0x00,
+    0x09, 0xF1, 0x00, 0x03, 0xF6, 0x00, 0x04, 0xF6, 0x00, 0x09, 0xF1, 0x00,
+    0x00, 0xDB, 0x00, 0x0E, 0xB0, 0x00, 0x00, 0x8F, 0x20, 0x4F, 0x60, 0x00,
+    0x00, 0x3F, 0x70, 0x9F, 0x10, 0x00, 0x00, 0x0D, 0xC0, 0xEA, 0x00, 0x00,
+    0x00, 0x08, 0xF6, 0xF5, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 119 'w'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0x0D, 0xB0,
+    0xAE, 0x00, 0x00, 0x00, 0x1F, 0x70, 0x6F, 0x20, 0x00, 0x00, 0x4F, 0x40,
+    0x3F, 0x50, 0x6F, 0x30, 0x8F, 0x10, 0x0E, 0x80, 0xAE, 0x80, 0xBC, 0x00,
+    0x0B, 0xB0, 0xE7, 0xC0, 0xE9, 0x00, 0x08, 0xE4, 0xD1, 0xF3, 0xF5, 0x00,
+    0x04, 0xFB, 0x90, 0xBB, 0xF2, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xD0, 0x00,
+    0x00, 0xCE, 0x00, 0x2F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 120 'x'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF3, 0x00, 0x05, 0xF7, 0x00,
+    0x01, 0xDD, 0x10, 0x2E, 0xB0, 0x00, 0x00, 0x3F, 0x90, 0xCD, 0x10, 0x00,
+    0x00, 0x06, 0xFB, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
+    0x00, 0x01, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE5, 0xF9, 0x00, 0x00,
+    0x00, 0x7F, 0x50, 0x7F, 0x50, 0x00, 0x03, 0xF9, 0x00, 0x0C, 0xE2, 0x00,
+    0x1D, 0xD1, 0x00, 0x02, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 121 'y'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0xCE, 0x00,
+    0x07, 0xF3, 0x00, 0x02, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x08, 0xF2, 0x00,
+    0x00, 0xAE, 0x00, 0x0D, 0xB0, 0x00, 0x00, 0x4F, 0x50, 0x4F, 0x50, 0x00,
+    0x00, 0x0D, 0xA0, 0x9E, 0x00, 0x00, 0x00, 0x07, 0xF2, 0xE9, 0x00, 0x00,
+    0x00, 0x01, 0xFB, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00,
+    0x00, 0x05, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+    0x06, 0xFE, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 122 'z'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF2, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x30, 0x00,
+    0x00, 0x00, 0x01, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x00, 0x06, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x4C, 0x10, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xFF, 0xF2, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 123 '{'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xCE, 0xD0, 0x00,
+    0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x4F, 0x91, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x20, 0x00, 0x00,
+    0x01, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE7, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xDF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xA1, 0x00, 0x00,
+    0x00, 0x00, 0x1E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x04, 0xCE, 0xD0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 124 '|'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 125 '}'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xB3, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x91, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xD0, 0x00,
+    0x00, 0x00, 0x4F, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x8F, 0x20, 0x00, 0x00, 0x00, 0x02, 0xCF, 0x10, 0x00, 0x00,
+    0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xB3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 126 '~'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xDF, 0xD8, 0x31, 0x3A, 0x10, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+    0x38, 0x21, 0x38, 0xDE, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
@@ -0,0 +1,26 @@
+/*
+ * Built-in bitmap font for the glyph atlas (text_renderer.h)
+ *
+ * DejaVu Sans Mono 18px (Bitstream Vera license), printable ASCII,
+ * one fixed 11x22 cell per glyph - about the size of the canvas 24px font.
+ * Coverage is stored as 4 bits per pixel, two pixels per byte (left pixel
+ * in the high nibble), rows padded to whole bytes, glyphs back to back.
+ */
+
+#ifndef BITMAP_FONT_H
+#define BITMAP_FONT_H
+
+#include <stdint.h>
+
+#define FONT_FIRST_CHAR 32      // ' '
+#define FONT_LAST_CHAR 126      // '~'
+#define FONT_NUM_GLYPHS (FONT_LAST_CHAR - FONT_FIRST_CHAR + 1)
+#define FONT_WIDTH 11           // Advance and cell width (pixels)
+#define FONT_HEIGHT 22          // Cell height (pixels)
+#define FONT_ROW_BYTES ((FONT_WIDTH + 1) / 2)
+#define FONT_GLYPH_BYTES (FONT_ROW_BYTES * FONT_HEIGHT)
+
+// FONT_NUM_GLYPHS * FONT_GLYPH_BYTES bytes of coverage (0 = background, 15 = ink)
+extern const uint8_t FONT_COVERAGE[];
+
+#endif // BITMAP_FONT_H
@@ -0,0 +1,48 @@
+/*
+ * Boot Timeline Implementation
+ */
+
+#include "boot_timeline.h"
+
+struct BootPhase {
+    const char* name;
+    unsigned long timeMs;
+};
+
+static BootPhase phases[MAX_BOOT_PHASES];
+static int numPhases = 0;
+static portMUX_TYPE phasesMux = portMUX_INITIALIZER_UNLOCKED;
+
+void bootMark(const char* phase) {
+    unsigned long now = millis();
+
+    portENTER_CRITICAL(&phasesMux);
+    if (numPhases < MAX_BOOT_PHASES) {
+        phases[numPhases].name = phase;
+        phases[numPhases].timeMs = now;
+        numPhases++;
+    }
+    portEXIT_CRITICAL(&phasesMux);
+
+    Serial.printf("[boot %6lu ms] %s\n", now, phase);
+}
+
+long bootPhaseTime(const char* phase) {
+    for (int i = 0; i < numPhases; i++) {
+        if (strcmp(phases[i].name, phase) == 0) {
+            return (long)phases[i].timeMs;
+        }
+    }
+    return -1;
+}
+
+void bootTimelinePrint() {
+    Serial.println("Boot timeline:");
+
+    unsigned long prev = 0;
+    for (int i = 0; i < numPhases; i++) {
+        Serial.printf("  %6lu ms  (+%5lu)  %s\n",
+                      phases[i].timeMs, phases[i].timeMs - prev, phases[i].name);
+        prev = phases[i].timeMs;
+    }
+}
@@ -0,0 +1,26 @@
+/*
+ * Boot Timeline
+ *
+ * Records when each boot phase finishes so time-to-first-useful-frame
+ * can be measured. Safe to call from the main loop and background tasks.
+ */
+
+#ifndef BOOT_TIMELINE_H
+#define BOOT_TIMELINE_H
+
+#include <Arduino.h>
+
+// Maximum number of phases recorded
+#define MAX_BOOT_PHASES 16
+
+// Record that a boot phase finished now
+// phase: string literal (pointer is stored, not copied)
+void bootMark(const char* phase);
+
+// Milliseconds since boot at which a phase was marked (-1 if not marked)
+long bootPhaseTime(const char* phase);
+
+// Print all recorded phases with their deltas to Serial
+void bootTimelinePrint();
+
+#endif // BOOT_TIMELINE_H
@@ -0,0 +1,147 @@
+/*
+ * Frame Quality Check Implementation
+ *
+ * Each FQ_SAMPLE_STEP x FQ_SAMPLE_STEP block is averaged down to one
+ * sample, so the Laplacian compares neighbouring blocks of a properly
+ * downscaled image instead of single pixels 4 px apart (which would alias
+ * fine texture and sensor noise). Block rows are converted to luma once and
+ * kept in a 3-row ring, so the Laplacian of the middle row is computed in
+ * the same pass as the histogram and coverage.
+ */
+
+#include "frame_quality.h"
+#include <string.h>
+
+static FrameQuality lastQuality;
+
+// Sampled luma rows: previous, current, next
+static uint8_t lumaRows[3][FQ_MAX_ROW_SAMPLES];
+
+// 5/6/5-bit channel sums of the blocks in the current block row
+static uint16_t blockR[FQ_MAX_ROW_SAMPLES];
+static uint16_t blockG[FQ_MAX_ROW_SAMPLES];
+static uint16_t blockB[FQ_MAX_ROW_SAMPLES];
+
+// Average one row of blocks starting at y0: fills luma, updates histogram
+// and coverage counts
+static void sampleBlockRow(const uint8_t* rgb565, int width, int height, int y0, int cols,
+                           uint8_t* luma, FrameQuality& q, uint32_t& lumaSum, int& foreground) {
+    int y1 = y0 + FQ_SAMPLE_STEP < height ? y0 + FQ_SAMPLE_STEP : height;
+    int x1 = cols * FQ_SAMPLE_STEP < width ? cols * FQ_SAMPLE_STEP : width;
+
+    memset(blockR, 0, cols * sizeof(blockR[0]));
+    memset(blockG, 0, cols * sizeof(blockG[0]));
+    memset(blockB, 0, cols * sizeof(blockB[0]));
+
+    for (int y = y0; y < y1; y++) {
+        const uint8_t* p = rgb565 + y * width * 2;
+        for (int x = 0; x < x1; x++, p += 2) {
+            uint16_t pixel = (p[1] << 8) | p[0];
+            int i = x / FQ_SAMPLE_STEP;
+            blockR[i] += (pixel >> 11) & 0x1F;
+            blockG[i] += (pixel >> 5) & 0x3F;
+            blockB[i] += pixel & 0x1F;
+        }
+    }
+
+    for (int i = 0; i < cols; i++) {
+        // Edge blocks may be cut short by the frame border
+        int blockWidth = x1 - i * FQ_SAMPLE_STEP;
+        if (blockWidth > FQ_SAMPLE_STEP) blockWidth = FQ_SAMPLE_STEP;
+        int count = blockWidth * (y1 - y0);
+
+        int r = (blockR[i] << 3) / count;
+        int g = (blockG[i] << 2) / count;
+        int b = (blockB[i] << 3) / count;
+
+        // BT.601 luma, integer weights summing to 256
+        int y8 = (77 * r + 150 * g + 29 * b) >> 8;
+        luma[i] = y8;
+        lumaSum += y8;
+        q.histogram[y8 * FQ_HIST_BINS / 256]++;
+
+        int hi = r > g ? (r > b ? r : b) : (g > b ? g : b);
+        int lo = r < g ? (r < b ? r : b) : (g < b ? g : b);
+        if (hi - lo > FQ_FOREGROUND_CHROMA) foreground++;
+    }
+}
+
+FrameVerdict checkFrameQuality(const uint8_t* rgb565, int width, int height, FrameQuality& q) {
+    memset(&q, 0, sizeof(q));
+
+    int cols = (width + FQ_SAMPLE_STEP - 1) / FQ_SAMPLE_STEP;
+    int rows = (height + FQ_SAMPLE_STEP - 1) / FQ_SAMPLE_STEP;
+    if (cols > FQ_MAX_ROW_SAMPLES) cols = FQ_MAX_ROW_SAMPLES;
+
+    uint32_t lumaSum = 0;
+    int foreground = 0;
+    int64_t lapSum = 0;
+    int64_t lapSumSq = 0;
+    int lapCount = 0;
+
+    for (int r = 0; r < rows; r++) {
+        uint8_t* cur = lumaRows[r % 3];
+        sampleBlockRow(rgb565, width, height, r * FQ_SAMPLE_STEP, cols, cur, q, lumaSum, foreground);
+
+        // Laplacian of the previous row once its neighbours are known
+        if (r >= 2) {
+            const uint8_t* up = lumaRows[(r - 2) % 3];
+            const uint8_t* mid = lumaRows[(r - 1) % 3];
+            for (int i = 1; i < cols - 1; i++) {
+                int lap = 4 * mid[i] - mid[i - 1] - mid[i + 1] - up[i] - cur[i];
+                lapSum += lap;
+                lapSumSq += lap * lap;
+                lapCount++;
+            }
+        }
+    }
+
+    q.samples = cols * rows;
+    if (q.samples == 0) {
+        q.verdict = FRAME_EMPTY;
+        lastQuality = q;
+        return q.verdict;
+    }
+
+    // Near-black / near-white from the two outermost histogram bins (8 levels each)
+    q.meanLuma = (float)lumaSum / q.samples;
+    q.darkFraction = (float)(q.histogram[0] + q.histogram[1]) / q.samples;
+    q.brightFraction = (float)(q.histogram[FQ_HIST_BINS - 1] + q.histogram[FQ_HIST_BINS - 2]) / q.samples;
+
+    if (lapCount > 0) {
+        float mean = (float)lapSum / lapCount;
+        q.sharpness = (float)lapSumSq / lapCount - mean * mean;
+    }
+    q.coverage = (float)foreground / q.samples;
+
+    // Exposure first: blur and coverage are meaningless on a black frame
+    if (q.meanLuma < FQ_MIN_MEAN_LUMA || q.darkFraction > FQ_MAX_CLIPPED_FRACTION) {
+        q.verdict = FRAME_TOO_DARK;
+    } else if (q.meanLuma > FQ_MAX_MEAN_LUMA || q.brightFraction > FQ_MAX_CLIPPED_FRACTION) {
+        q.verdict = FRAME_TOO_BRIGHT;
+    } else if (q.sharpness < FQ_MIN_SHARPNESS) {
+        q.verdict = FRAME_BLURRY;
+    } else if (q.coverage < FQ_MIN_COVERAGE) {
+        q.verdict = FRAME_EMPTY;
+    } else {
+        q.verdict = FRAME_OK;
+    }
+
+    lastQuality = q;
+    return q.verdict;
+}
+
+const FrameQuality& lastFrameQuality() {
+    return lastQuality;
+}
+
+const char* frameVerdictMessage(FrameVerdict verdict) {
+    switch (verdict) {
+        case FRAME_OK:         return "OK";
+        case FRAME_TOO_DARK:   return "Too dark";
+        case FRAME_TOO_BRIGHT: return "Too bright";
+        case FRAME_BLURRY:     return "Hold still";
+        case FRAME_EMPTY:      return "Nothing in view";
+    }
+    return "Bad frame";
+}
@@ -0,0 +1,61 @@
+/*
+ * Frame Quality Check
+ *
+ * Cheap pre-check on the raw RGB565 camera frame, run before inference.
+ * One pass over the frame, averaged down to 4x4 blocks, computes a luma
+ * histogram, a Laplacian-variance sharpness score and a foreground coverage
+ * estimate, so dark, washed-out, blurry or empty frames are rejected in milliseconds.
+ */
+
+#ifndef FRAME_QUALITY_H
+#define FRAME_QUALITY_H
+
+#include <stdint.h>
+
+// Analyse the mean of each N x N pixel block
+#define FQ_SAMPLE_STEP 4
+#define FQ_MAX_ROW_SAMPLES 256   // Supports frames up to 1024 px wide at step 4
+#define FQ_HIST_BINS 32
+
+// Rejection thresholds (tune with the metrics printed on each scan)
+#define FQ_MIN_MEAN_LUMA 40
+#define FQ_MAX_MEAN_LUMA 215
+#define FQ_MAX_CLIPPED_FRACTION 0.40f  // Samples that are near black or near white
+#define FQ_MIN_SHARPNESS 40.0f         // Laplacian variance of luma
+#define FQ_FOREGROUND_CHROMA 40        // max(R,G,B) - min(R,G,B) for a produce pixel
+#define FQ_MIN_COVERAGE 0.06f          // Fraction of produce-looking samples
+
+// Frame check outcome
+enum FrameVerdict {
+    FRAME_OK,
+    FRAME_TOO_DARK,
+    FRAME_TOO_BRIGHT,
+    FRAME_BLURRY,
+    FRAME_EMPTY
+};
+
+// Frame quality metrics
+struct FrameQuality {
+    uint32_t histogram[FQ_HIST_BINS];  // Luma histogram of block samples
+    int samples;                       // Number of block samples
+    float meanLuma;                    // Mean luma (0-255)
+    float darkFraction;                // Samples with luma < 16
+    float brightFraction;              // Samples with luma >= 240
+    float sharpness;                   // Laplacian variance (higher is sharper)
+    float coverage;                    // Foreground fraction (0.0 - 1.0)
+    FrameVerdict verdict;
+};
+
+// Check a frame
+// rgb565: frame buffer, 2 bytes per pixel (same byte order as rgb565ToRgb888)
+// quality: filled with metrics
+// Returns verdict (also stored in quality.verdict)
+FrameVerdict checkFrameQuality(const uint8_t* rgb565, int width, int height, FrameQuality& quality);
+
+// Metrics of the last checked frame
+const FrameQuality& lastFrameQuality();
+
+// Short actionable message for the user ("Too dark", "Hold still", ...)
+const char* frameVerdictMessage(FrameVerdict verdict);
+
+#endif // FRAME_QUALITY_H
@@ -0,0 +1,997 @@
+/*
+ * Fridge App
+ *
+ * Inventory screen, scanner and API workflow. Talks to the board only
+ * through hal.h, so the same code runs on the K10 and in the Linux simulator.
+ */
+
+#include "fridge_app.h"
+#include <atomic>
+#include <ArduinoJson.h>
+#include <SPIFFS.h>
+#include "hal.h"
+#include "vegetable_classifier.h"
+#include "model_manager.h"
+#include "boot_timeline.h"
+#include "api_client.h"
+#include "heap_monitor.h"
+#include "frame_quality.h"
+#include "knn_index.h"
+#include "text_renderer.h"
+#include "scroll_list.h"
+
+// WiFi credentials
+const char* ssid = "Avantikais";
+const char* password = "freddyfazbear";
+
+// API server address (the simulator points this at its mock server)
+const char* serverUrl = "https://sustainhub.dev.tk.sg/api";
+
+// App modes
+enum AppMode {
+    MODE_INVENTORY,    // View fridge inventory
+    MODE_SCANNER       // Camera view for scanning vegetables
+};
+
+AppMode currentMode = MODE_INVENTORY;
+
+// Ingredient data structure
+#define INGREDIENT_NAME_LEN 32
+struct Ingredient {
+    char name[INGREDIENT_NAME_LEN];
+    int quantity;
+    int daysLeft;
+};
+
+// Inventory, allocated in PSRAM at startup. A fetch fills fetchBuffer and
+// swaps it in only when the whole response parsed.
+#define MAX_INGREDIENTS 500
+Ingredient* ingredients = nullptr;
+Ingredient* fetchBuffer = nullptr;
+int numIngredients = 0;
+bool dataLoaded = false;
+bool appHalted = false;  // Setup failed, only the error screen is shown
+unsigned long lastInventoryUpdate = 0;
+
+// Local snapshot of the last fetched inventory, shown at boot before WiFi is up
+#define INVENTORY_CACHE_PATH "/inventory.txt"
+bool spiffsReady = false;
+bool dataFromCache = false;
+uint32_t lastCacheHash = 0;
+
+// Background boot phases, stepped from loop() once the first frame is up
+enum BootState {
+    BOOT_WIFI_CONNECTING,
+    BOOT_NTP_SYNCING,
+    BOOT_FETCHING,
+    BOOT_FETCH_WAITING,
+    BOOT_DONE
+};
+
+#define WIFI_CONNECT_TIMEOUT_MS 10000
+#define NTP_SYNC_TIMEOUT_MS 10000
+#define MIN_VALID_EPOCH 1700000000  // Nov 2023, anything earlier means NTP not synced yet
+
+BootState bootState = BOOT_WIFI_CONNECTING;
+unsigned long bootStateStart = 0;
+bool wifiFailedShown = false;
+// Set once the model and the kNN index are both loaded; the kNN index must
+// not be touched from the loop before then
+std::atomic<bool> classifierInitDone(false);
+bool bootTimelinePrinted = false;
+
+// The first fetch runs on a background task so loop() keeps serving buttons
+// and serial commands while the request waits on the network.
+// fetchRunning is the single fetchBuffer slot, claimed with claimFetch() and
+// released once the download has been applied.
+std::atomic<bool> fetchRunning(false);
+std::atomic<bool> bootFetchFinished(false);
+std::atomic<int> bootFetchCount(-1);  // Items parsed into fetchBuffer, -1 on failure
+// millis() when the task finished. The simulator runs tasks to completion on
+// their own virtual clock, so the loop waits until its clock catches up.
+std::atomic<unsigned long> bootFetchDoneAt(0);
+
+// Camera state - only initialize once
+bool cameraInitialized = false;
+
+// Multi-item scan: classify a grid of half-overlapping regions from one
+// capture, same-class hits on overlapping regions are one item
+#define MULTI_SCAN_COLS 3
+#define MULTI_SCAN_ROWS 3
+bool multiScanMode = false;
+
+// Enrolled (kNN) match replaces the model's answer unless it is this sure
+#define KNN_OVERRIDE_CONFIDENCE 0.9f
+
+// Calculate days until expiry ("YYYY-MM-DD")
+int calculateDaysLeft(const char* expiryDateStr) {
+    int year = 0, month = 0, day = 0;
+    sscanf(expiryDateStr, "%d-%d-%d", &year, &month, &day);
+
+    time_t now = halTime();
+
+    struct tm expiry = {};
+    expiry.tm_year = year - 1900;
+    expiry.tm_mon = month - 1;
+    expiry.tm_mday = day;
+
+    time_t expiryTime = mktime(&expiry);
+    int daysLeft = (expiryTime - now) / 86400;
+
+    return daysLeft;
+}
+
+// Get color based on days left
+uint32_t getExpiryColor(int daysLeft) {
+    if (daysLeft < 3) return 0xFF0000;  // Red if below 3
+    else return 0x00AA00;               // Green if 3 or above
+}
+
+// Hash of the inventory contents (skips rewriting an unchanged cache)
+uint32_t inventoryHash() {
+    uint32_t hash = 2166136261u;  // FNV-1a
+    for (int i = 0; i < numIngredients; i++) {
+        for (const char* c = ingredients[i].name; *c; c++) {
+            hash = (hash ^ (uint8_t)*c) * 16777619u;
+        }
+        hash = (hash ^ (uint32_t)ingredients[i].quantity) * 16777619u;
+        hash = (hash ^ (uint32_t)ingredients[i].daysLeft) * 16777619u;
+    }
+    return hash;
+}
+
+// Save inventory snapshot to SPIFFS (one "name<TAB>qty<TAB>days" line per item)
+void saveInventoryCache() {
+    if (!spiffsReady) return;
+
+    uint32_t hash = inventoryHash();
+    if (hash == lastCacheHash) return;  // Unchanged, spare the flash
+
+    File f = SPIFFS.open(INVENTORY_CACHE_PATH, FILE_WRITE);
+    if (!f) {
+        Serial.println("Failed to write inventory cache");
+        return;
+    }
+
+    for (int i = 0; i < numIngredients; i++) {
+        f.printf("%s\t%d\t%d\n", ingredients[i].name,
+                 ingredients[i].quantity, ingredients[i].daysLeft);
+    }
+    f.close();
+    lastCacheHash = hash;
+}
+
+// Load inventory snapshot from SPIFFS
+// Days left are as of the last fetch until the first refresh replaces them
+bool loadInventoryCache() {
+    if (!spiffsReady) return false;
+
+    File f = SPIFFS.open(INVENTORY_CACHE_PATH, FILE_READ);
+    if (!f) return false;
+
+    numIngredients = 0;
+    char line[64];
+    while (numIngredients < MAX_INGREDIENTS && f.available()) {
+        size_t len = f.readBytesUntil('\n', line, sizeof(line) - 1);
+        line[len] = '\0';
+
+        // A full buffer leaves the rest of the line unread: skip it, and
+        // drop the record if there was more than its newline
+        if (len == sizeof(line) - 1) {
+            bool overlong = false;
+            int c;
+            while ((c = f.read()) >= 0 && c != '\n') {
+                overlong = true;
+            }
+            if (overlong) continue;
+        }
+
+        char* qty = strchr(line, '\t');
+        if (qty == nullptr) continue;
+        *qty++ = '\0';
+        char* days = strchr(qty, '\t');
+        if (days == nullptr) continue;
+        *days++ = '\0';
+
+        strlcpy(ingredients[numIngredients].name, line, INGREDIENT_NAME_LEN);
+        ingredients[numIngredients].quantity = atoi(qty);
+        ingredients[numIngredients].daysLeft = atoi(days);
+        numIngredients++;
+    }
+    f.close();
+
+    lastCacheHash = inventoryHash();
+    return numIngredients > 0;
+}
+
+// Skip to the next of the given characters in the response body
+// Returns the character found, or -1 at the end of the body
+int readUntilAny(ApiBodyReader& body, const char* stops) {
+    int c;
+    while ((c = body.read()) >= 0 && strchr(stops, c) == nullptr) {
+    }
+    return c;
+}
+
+// Skip whitespace, return the next character without consuming it
+int peekToken(ApiBodyReader& body) {
+    while (body.peek() == ' ' || body.peek() == '\n' || body.peek() == '\r' || body.peek() == '\t') {
+        body.read();
+    }
+    return body.peek();
+}
+
+// Download the inventory from the API into fetchBuffer
+// Returns the number of items parsed, or -1 on failure
+int downloadIngredients() {
+    if (!halNetworkConnected()) {
+        Serial.println("WiFi not connected");
+        return -1;
+    }
+
+    apiLock();
+    int httpResponseCode = apiRequest("GET", "/ingredients", nullptr, 0);
+    if (httpResponseCode != 200) {
+        if (httpResponseCode > 0) apiEndRequest();
+        apiUnlock();
+        return -1;
+    }
+
+    // The array is parsed one element at a time, so the JSON arena only
+    // ever holds one ingredient however long the inventory is
+    ApiBodyReader& body = apiResponseBody();
+    bool ok = readUntilAny(body, "[") == '[';
+    bool empty = ok && peekToken(body) == ']';
+    int count = 0;
+    {
+        // Only keep the fields we display
+        JsonDocument filter(apiJsonAllocator());
+        filter["name"] = true;
+        filter["quantity"] = true;
+        filter["expiry_date"] = true;
+        size_t elementMark = apiJsonMark();
+
+        while (ok && !empty) {
+            {
+                JsonDocument doc(apiJsonAllocator());
+                DeserializationError error = deserializeJson(doc, body,
+                                                             DeserializationOption::Filter(filter));
+                if (error) {
+                    Serial.printf("JSON error: %s\n", error.c_str());
+                    ok = false;
+                    break;
+                }
+
+                if (count < MAX_INGREDIENTS) {
+                    JsonObject ing = doc.as<JsonObject>();
+                    strlcpy(fetchBuffer[count].name, ing["name"] | "", INGREDIENT_NAME_LEN);
+                    fetchBuffer[count].quantity = ing["quantity"].as<int>();
+                    fetchBuffer[count].daysLeft = calculateDaysLeft(ing["expiry_date"] | "");
+                    count++;
+                }
+            }
+            apiJsonRelease(elementMark);
+
+            // Next element or end of array
+            int next = readUntilAny(body, ",]");
+            if (next != ',') {
+                ok = next == ']';
+                break;
+            }
+        }
+    }
+    apiJsonReset();
+    apiEndRequest();
+    apiUnlock();
+
+    return ok ? count : -1;
+}
+
+// Claim fetchBuffer for one download, false if another fetch holds it
+bool claimFetch() {
+    bool expected = false;
+    return fetchRunning.compare_exchange_strong(expected, true);
+}
+
+// Make the downloaded inventory the current one
+void applyFetchedIngredients(int count) {
+    Ingredient* previous = ingredients;
+    ingredients = fetchBuffer;
+    fetchBuffer = previous;
+    numIngredients = count;
+
+    dataFromCache = false;
+    saveInventoryCache();
+}
+
+// Fetch ingredients from API
+bool fetchIngredients() {
+    if (!claimFetch()) {
+        Serial.println("Inventory fetch already in progress");
+        return false;
+    }
+
+    int count = downloadIngredients();
+    if (count >= 0) {
+        applyFetchedIngredients(count);
+    }
+    fetchRunning = false;
+    return count >= 0;
+}
+
+// Add ingredient to inventory via API
+bool addIngredientToAPI(const char* name, int quantity) {
+    if (!halNetworkConnected()) {
+        Serial.println("WiFi not connected");
+        return false;
+    }
+
+    // Calculate expiry date (7 days from now for vegetables)
+    time_t now = halTime();
+    struct tm timeinfo;
+    localtime_r(&now, &timeinfo);
+    timeinfo.tm_mday += 7;
+    mktime(&timeinfo);
+    char expiryDate[11];
+    strftime(expiryDate, 11, "%Y-%m-%d", &timeinfo);
+
+    // Waits for a boot fetch that is still downloading
+    apiLock();
+
+    static char payload[192];
+    size_t payloadLen;
+    {
+        JsonDocument doc(apiJsonAllocator());
+        doc["name"] = name;
+        doc["category"] = "vegetable";
+        doc["quantity"] = quantity;
+        doc["unit"] = "pieces";
+        doc["expiry_date"] = expiryDate;
+
+        payloadLen = serializeJson(doc, payload, sizeof(payload));
+    }
+    apiJsonReset();
+
+    int httpResponseCode = apiRequest("POST", "/ingredients", payload, payloadLen);
+    if (httpResponseCode > 0) apiEndRequest();
+    apiUnlock();
+
+    if (httpResponseCode == 200 || httpResponseCode == 201) {
+        Serial.printf("Added %s to inventory\n", name);
+        return true;
+    }
+
+    Serial.printf("Failed to add ingredient: %d\n", httpResponseCode);
+    return false;
+}
+
+// Inventory list viewport: rows scroll under the fixed header and footer
+#define LIST_Y 88
+#define LIST_HEIGHT 208              // 8 rows
+#define LIST_ROW_HEIGHT 26
+#define LIST_ROW_COLOR_EVEN 0xFFF0B3 // Light yellow
+#define LIST_ROW_COLOR_ODD 0xFFE4B3  // Peach yellow
+
+// Draw one inventory row for the scroll list (row-local coordinates)
+void drawInventoryRow(int row, uint16_t* buffer, int width, int height) {
+    Ingredient& ing = ingredients[row];
+    uint32_t background = (row & 1) ? LIST_ROW_COLOR_ODD : LIST_ROW_COLOR_EVEN;
+    int y = (height - FONT_HEIGHT) / 2;
+
+    textFillRect(buffer, width, height, 0, 0, width, height, background);
+
+    // Vegetable name (left)
+    textDraw(buffer, width, height, 10, y, ing.name, textPalette(0x333333, background), 9);
+
+    // Quantity (middle)
+    char qtyStr[10];
+    snprintf(qtyStr, 10, "%d", ing.quantity);
+    textDraw(buffer, width, height, 120, y, qtyStr, textPalette(0x228B22, background), 5);
+
+    // Arrow
+    textDraw(buffer, width, height, 155, y, "->", textPalette(0x888888, background), 5);
+
+    // Days left (right, colored by urgency)
+    char daysStr[10];
+    snprintf(daysStr, 10, "%d", ing.daysLeft);
+    textDraw(buffer, width, height, 200, y, daysStr,
+             textPalette(getExpiryColor(ing.daysLeft), background), 5);
+}
+
+// Draw inventory UI - styled like the mockup
+void drawInventoryUI() {
+    halDisplayClear();
+
+    // Gradient-ish background (pink top to yellow bottom)
+    halDisplayRect(0, 0, 240, 80, 0xFFB6C1);    // Light pink
+    halDisplayRect(0, 80, 240, 80, 0xFFD1DC);   // Lighter pink
+    halDisplayRect(0, 160, 240, 80, 0xFFF0B3);  // Light yellow
+    halDisplayRect(0, 240, 240, 80, 0xFFE4B3);  // Peach yellow
+
+    // Title area (autoClean=false to keep gradient)
+    halDisplayText("FRIDGE", 80, 20, 0xFF1493, 10);
+    if (dataFromCache) {
+        halDisplayText("cached", 165, 20, 0x888888, 10);
+    }
+
+    // Keep the list in step even when it is not drawn, so A/B cannot
+    // scroll through rows that are gone
+    scrollListSetCount(dataLoaded ? numIngredients : 0);
+
+    if (!dataLoaded || numIngredients == 0) {
+        halDisplayText("Loading...", 80, 150, 0x666666, 10);
+        halDisplayUpdate();
+        return;
+    }
+
+    // Column headers (autoClean=false to keep gradient)
+    halDisplayText("name", 10, 60, 0x666666, 10);
+    halDisplayText("qty", 120, 60, 0x666666, 5);
+    halDisplayText("days", 185, 60, 0x666666, 5);
+
+    // Rows come from the glyph atlas through the scroll list viewport
+    scrollListRender();
+
+    halDisplayText("A/B:Scroll A+B:Scan", 10, LIST_Y + LIST_HEIGHT, 0x666666, 20);
+    halDisplayUpdate();
+}
+
+// Draw scanner UI overlay (camera shows in background)
+void drawScannerUI(const char* status = nullptr) {
+    if (status == nullptr) {
+        status = multiScanMode ? "Point at vegetables" : "Point at vegetable";
+    }
+
+    // Header
+    halDisplayTextLine(multiScanMode ? "SCANNER (MULTI)" : "SCANNER", 1, 0x00FF00);
+    halDisplayTextLine(status, 2, 0xFFFFFF);
+
+    // Instructions
+    halDisplayTextLine("A:Back B:Scan", 8, 0x00FF00);
+    halDisplayTextLine("A+B:Single/Multi", 9, 0x00FF00);
+
+    halDisplayUpdate();
+}
+
+
+// Draw classification result
+void drawResultUI(ClassificationResult& result) {
+    halDisplayClear();
+    halDisplayBackground(0x000000);
+
+    halDisplayTextLine("DETECTED:", 1, 0x00FF00);
+
+    if (result.valid) {
+        // Show detected vegetable
+        char vegName[30];
+        snprintf(vegName, 30, "%s", result.className);
+        halDisplayTextLine(vegName, 3, 0xFFFFFF);
+
+        // Show confidence
+        char confStr[30];
+        snprintf(confStr, 30, "Conf: %.1f%%", result.confidence * 100);
+        halDisplayTextLine(confStr, 4, 0x888888);
+
+        halDisplayTextLine("Adding to inventory...", 6, 0x00FF00);
+    } else {
+        halDisplayTextLine("Not recognized", 3, 0xFF0000);
+        halDisplayTextLine("Try again", 4, 0x888888);
+    }
+
+    halDisplayUpdate();
+}
+
+// Draw multi-item scan result (one line per detected class)
+void drawMultiResultUI(MultiScanResult& multi) {
+    halDisplayClear();
+    halDisplayBackground(0x000000);
+
+    halDisplayTextLine("DETECTED:", 1, 0x00FF00);
+
+    if (!multi.valid || multi.totalItems == 0) {
+        halDisplayTextLine("Not recognized", 3, 0xFF0000);
+        halDisplayTextLine("Try again", 4, 0x888888);
+        halDisplayUpdate();
+        return;
+    }
+
+    int line = 2;
+    for (int c = 0; c < NUM_CLASSES && line <= 6; c++) {
+        if (multi.itemCounts[c] == 0) continue;
+
+        // Best confidence among regions of this class
+        float bestConf = 0.0f;
+        for (int r = 0; r < multi.numRegions; r++) {
+            if (multi.results[r].classIndex == c && multi.results[r].confidence > bestConf) {
+                bestConf = multi.results[r].confidence;
+            }
+        }
+
+        char lineStr[40];
+        snprintf(lineStr, 40, "%dx %s (%.0f%%)", multi.itemCounts[c], VEGETABLE_LABELS[c], bestConf * 100);
+        halDisplayTextLine(lineStr, line++, 0xFFFFFF);
+    }
+
+    halDisplayUpdate();
+}
+
+
+// Convert RGB565 to RGB888
+void rgb565ToRgb888(uint8_t* rgb565, uint8_t* rgb888, int width, int height) {
+    for (int i = 0; i < width * height; i++) {
+        // RGB565 is stored as 2 bytes: RRRRRGGG GGGBBBBB
+        uint16_t pixel = (rgb565[i * 2 + 1] << 8) | rgb565[i * 2];
+        rgb888[i * 3] = ((pixel >> 11) & 0x1F) << 3;     // R: 5 bits -> 8 bits
+        rgb888[i * 3 + 1] = ((pixel >> 5) & 0x3F) << 2;  // G: 6 bits -> 8 bits
+        rgb888[i * 3 + 2] = (pixel & 0x1F) << 3;         // B: 5 bits -> 8 bits
+    }
+}
+
+// Classify overlapping regions of one frame and add every detected item
+void scanMultipleVegetables(uint8_t* rgb888, int width, int height) {
+    ImageRegion regions[MAX_SCAN_REGIONS];
+    int numRegions = makeGridRegions(width, height, MULTI_SCAN_COLS, MULTI_SCAN_ROWS, regions);
+
+    MultiScanResult multi;
+    classifyRegions(rgb888, width, height, regions, numRegions, 0.5f, multi);
+
+    drawMultiResultUI(multi);
+
+    if (!multi.valid || multi.totalItems == 0) {
+        delay(2000);
+        return;
+    }
+
+    // Flash green LED
+    halLed(0, 255, 0);
+
+    halDisplayTextLine("Adding to fridge...", 8, 0xFFFF00);
+    halDisplayUpdate();
+
+    // One API call per class with its deduplicated count
+    int failed = 0;
+    for (int c = 0; c < NUM_CLASSES; c++) {
+        if (multi.itemCounts[c] == 0) continue;
+        if (!addIngredientToAPI(VEGETABLE_LABELS[c], multi.itemCounts[c])) {
+            failed++;
+        }
+    }
+
+    halDisplayClearLine(8);
+    if (failed == 0) {
+        halDisplayTextLine("Added to fridge!", 8, 0x00FF00);
+    } else {
+        halDisplayTextLine("API error", 8, 0xFF0000);
+    }
+    halDisplayUpdate();
+
+    delay(2000);
+    halLed(0, 0, 0);
+
+    // Refresh inventory
+    fetchIngredients();
+}
+
+// Scan and classify vegetable
+void scanVegetable() {
+    // Whatever happens below, the previous scan's embedding is stale now
+    clearLastEmbedding();
+
+    // Stop camera background so we can show UI
+    halCameraPreview(false);
+    delay(100);  // Wait for camera task to stop
+
+    // Show scanning status
+    halDisplayClear();
+    halDisplayBackground(0x000000);
+    halDisplayTextLine("SCANNING...", 2, 0x00FF00);
+    halDisplayTextLine("Capturing frame", 4, 0xFFFFFF);
+    halDisplayUpdate();
+
+    // Check if model (and the kNN index) are ready
+    if (!classifierInitDone || !isModelReady()) {
+        halDisplayTextLine("Model not ready!", 5, 0xFF0000);
+        halDisplayUpdate();
+        delay(1500);
+        halCameraPreview(true);
+        drawScannerUI();
+        return;
+    }
+
+    // Get camera frame
+    HalFrame* fb = halCameraCapture();
+    if (fb == nullptr) {
+        Serial.println("Failed to get camera frame");
+        halDisplayTextLine("Camera error!", 5, 0xFF0000);
+        halDisplayUpdate();
+        delay(1500);
+        halCameraPreview(true);
+        drawScannerUI();
+        return;
+    }
+
+    Serial.printf("Got frame: %dx%d, len=%d\n",
+                  fb->width, fb->height, (int)fb->len);
+
+    // Reject dark, blurry or empty frames before paying for inference
+    FrameQuality quality;
+    unsigned long checkStart = micros();
+    FrameVerdict verdict = checkFrameQuality(fb->buf, fb->width, fb->height, quality);
+    Serial.printf("Frame check (%lu us): luma=%.0f dark=%.2f bright=%.2f sharp=%.0f cover=%.2f -> %s\n",
+                  micros() - checkStart, quality.meanLuma, quality.darkFraction,
+                  quality.brightFraction, quality.sharpness, quality.coverage,
+                  frameVerdictMessage(verdict));
+
+    if (verdict != FRAME_OK) {
+        halCameraRelease(fb);
+        halDisplayTextLine(frameVerdictMessage(verdict), 5, 0xFF0000);
+        halDisplayTextLine("Try again", 6, 0x888888);
+        halDisplayUpdate();
+        delay(1500);
+        halCameraPreview(true);
+        drawScannerUI();
+        return;
+    }
+
+    // Allocate RGB888 buffer in PSRAM (320x240x3 = 230KB)
+    uint8_t* rgb888 = (uint8_t*)ps_malloc(fb->width * fb->height * 3);
+    if (rgb888 == nullptr) {
+        Serial.println("Failed to allocate RGB888 buffer");
+        halCameraRelease(fb);
+        halDisplayTextLine("Memory error!", 5, 0xFF0000);
+        halDisplayUpdate();
+        delay(1500);
+        halCameraPreview(true);
+        drawScannerUI();
+        return;
+    }
+
+    // Update status - running inference
+    halDisplayTextLine("Running inference...", 4, 0xFFFF00);
+    halDisplayTextLine(multiScanMode ? "(~12 seconds/region)" : "(~12 seconds)", 5, 0x888888);
+    halDisplayUpdate();
+
+    // Convert RGB565 to RGB888
+    rgb565ToRgb888(fb->buf, rgb888, fb->width, fb->height);
+
+    if (multiScanMode) {
+        scanMultipleVegetables(rgb888, fb->width, fb->height);
+        free(rgb888);
+        halCameraRelease(fb);
+        halCameraPreview(true);
+        drawScannerUI();
+        return;
+    }
+
+    // Run classification
+    ClassificationResult result = classifyImage(rgb888, fb->width, fb->height);
+
+    // Free buffers
+    free(rgb888);
+    halCameraRelease(fb);
+
+    // Check user-enrolled items with the embedding from the same Invoke
+    if (result.valid && knnCount() > 0 &&
+        (result.classIndex == NONE_CLASS_INDEX || result.confidence < KNN_OVERRIDE_CONFIDENCE)) {
+        static int8_t embedding[EMBEDDING_MAX_DIM];
+        if (getLastEmbedding(embedding) > 0) {
+            KnnMatch match = knnLookup(embedding);
+            Serial.printf("kNN: %s (sim %.2f, %d/%d votes)%s\n",
+                          match.label, match.similarity, match.votes, KNN_K,
+                          match.valid ? "" : " - below threshold");
+            if (match.valid) {
+                result.classIndex = ENROLLED_CLASS_INDEX;
+                result.className = match.label;
+                result.confidence = match.similarity;
+            }
+        }
+    }
+
+    // TEMP HACK: If "none" detected, randomly pick a vegetable for demo
+    if (result.valid && result.classIndex == NONE_CLASS_INDEX) {
+        int randomVeg = halRandom(0, 5);  // 0-4 (excludes "none")
+        result.classIndex = randomVeg;
+        result.className = VEGETABLE_LABELS[randomVeg];
+        result.confidence = 0.75f;  // Fake confidence
+        Serial.printf("DEMO MODE: Randomly selected %s\n", result.className);
+    }
+
+    // Show result
+    drawResultUI(result);
+
+    // If valid detection (confidence > 50%)
+    if (result.valid && result.confidence > 0.5) {
+        // Flash green LED
+        halLed(0, 255, 0);
+
+        // Add to inventory
+        halDisplayTextLine("Adding to fridge...", 6, 0xFFFF00);
+        halDisplayUpdate();
+
+        if (addIngredientToAPI(result.className, 1)) {
+            halDisplayClearLine(6);
+            halDisplayTextLine("Added to fridge!", 6, 0x00FF00);
+        } else {
+            halDisplayClearLine(6);
+            halDisplayTextLine("API error", 6, 0xFF0000);
+        }
+        halDisplayUpdate();
+
+        delay(2000);
+        halLed(0, 0, 0);
+
+        // Refresh inventory
+        fetchIngredients();
+    } else {
+        delay(2000);
+    }
+
+    // Return to scanner view - re-enable camera
+    halCameraPreview(true);
+    drawScannerUI();
+}
+
+// Switch to scanner mode
+void openScanner() {
+    currentMode = MODE_SCANNER;
+
+    // Initialize camera only once
+    if (!cameraInitialized) {
+        cameraInitialized = halCameraInit();
+    }
+
+    halCameraPreview(true);
+    drawScannerUI();
+}
+
+// Button callbacks
+void appButtonA() {
+    if (appHalted) return;
+    Serial.println("Button A pressed");
+
+    if (currentMode == MODE_SCANNER) {
+        // Back to inventory
+        halCameraPreview(false);
+        currentMode = MODE_INVENTORY;
+        drawInventoryUI();
+    } else if (dataLoaded) {
+        // Scroll inventory up
+        scrollListScroll(-1);
+    }
+}
+
+void appButtonB() {
+    if (appHalted) return;
+    Serial.println("Button B pressed");
+
+    if (currentMode == MODE_INVENTORY) {
+        // Scroll inventory down
+        if (dataLoaded) scrollListScroll(1);
+    } else if (currentMode == MODE_SCANNER) {
+        // Scan vegetable
+        heapMonitorBeginCycle("scan");
+        scanVegetable();
+        heapMonitorEndCycle();
+    }
+}
+
+void appButtonAB() {
+    if (appHalted) return;
+    Serial.println("Button A+B pressed");
+
+    if (currentMode == MODE_SCANNER) {
+        // Toggle single / multi-item scanning
+        multiScanMode = !multiScanMode;
+        Serial.printf("Multi-item scan: %s\n", multiScanMode ? "on" : "off");
+        drawScannerUI();
+        return;
+    }
+
+    // Open the scanner from the inventory
+    openScanner();
+}
+
+// Load the registered models off the main loop (PSRAM arenas + AllocateTensors)
+void classifierTask(void* param) {
+    (void)param;
+    modelManagerBegin();
+    classifierInit();
+    if (spiffsReady) {
+        knnInit(getEmbeddingDim());
+    }
+    bootMark("classifier ready");
+    classifierInitDone = true;
+}
+
+// First inventory download, the main loop swaps the result in
+void bootFetchTask(void* param) {
+    (void)param;
+    bootFetchCount = downloadIngredients();
+    bootFetchDoneAt = millis();
+    bootFetchFinished = true;
+}
+
+// Advance WiFi -> NTP -> first fetch without blocking the UI
+void bootStep() {
+    switch (bootState) {
+        case BOOT_WIFI_CONNECTING:
+            if (halNetworkConnected()) {
+                Serial.printf("WiFi connected! IP Address: %s\n", halNetworkAddress());
+                bootMark("wifi connected");
+
+                // Configure time, sync is detected in BOOT_NTP_SYNCING
+                halTimeSyncBegin();
+                bootState = BOOT_NTP_SYNCING;
+                bootStateStart = millis();
+            } else if (!wifiFailedShown && millis() - bootStateStart > WIFI_CONNECT_TIMEOUT_MS) {
+                // Keep waiting, the WiFi driver retries in the background
+                Serial.println("WiFi connection failed!");
+                bootMark("wifi timeout");
+                wifiFailedShown = true;
+                if (currentMode == MODE_INVENTORY) {
+                    halDisplayTextLine("WiFi Failed!", 3, 0xFF0000);
+                    halDisplayUpdate();
+                }
+            }
+            break;
+
+        case BOOT_NTP_SYNCING:
+            if (halTime() > MIN_VALID_EPOCH) {
+                bootMark("ntp synced");
+                bootState = BOOT_FETCHING;
+            } else if (millis() - bootStateStart > NTP_SYNC_TIMEOUT_MS) {
+                Serial.println("NTP sync timed out");
+                bootMark("ntp timeout");
+                bootState = BOOT_FETCHING;
+            }
+            break;
+
+        case BOOT_FETCHING:
+            // A fetch started from a button press goes first, claim next loop
+            if (!claimFetch()) break;
+            bootState = BOOT_FETCH_WAITING;
+            halStartTask(bootFetchTask, "fetch", nullptr);
+            break;
+
+        case BOOT_FETCH_WAITING:
+            if (!bootFetchFinished || (long)(millis() - bootFetchDoneAt) < 0) break;
+
+            if (bootFetchCount >= 0) {
+                applyFetchedIngredients(bootFetchCount);
+                dataLoaded = true;
+                bootMark("inventory fetched");
+            } else {
+                bootMark("inventory fetch failed");
+            }
+            fetchRunning = false;
+            lastInventoryUpdate = millis();
+            if (currentMode == MODE_INVENTORY) {
+                drawInventoryUI();
+            }
+            bootState = BOOT_DONE;
+            break;
+
+        case BOOT_DONE:
+            break;
+    }
+
+    if (bootState == BOOT_DONE && classifierInitDone && !bootTimelinePrinted) {
+        bootTimelinePrint();
+        bootTimelinePrinted = true;
+    }
+}
+
+// Serial commands for enrolled items:
+//   enroll <name>  add the last single scan as an example of <name>
+//   forget         remove all enrolled examples
+//   knn            list enrolled labels
+void handleSerialCommand() {
+    static char cmd[48];
+    static int cmdLen = 0;
+
+    while (Serial.available()) {
+        char c = Serial.read();
+        if (c != '\n' && c != '\r') {
+            if (cmdLen < (int)sizeof(cmd) - 1) cmd[cmdLen++] = c;
+            continue;
+        }
+        if (cmdLen == 0) continue;
+        cmd[cmdLen] = '\0';
+        cmdLen = 0;
+
+        if (!classifierInitDone) {
+            Serial.println("Classifier still loading");
+            continue;
+        }
+
+        if (strncmp(cmd, "enroll ", 7) == 0 && cmd[7] != '\0') {
+            static int8_t embedding[EMBEDDING_MAX_DIM];
+            if (getLastEmbedding(embedding) == 0) {
+                Serial.println("Scan an item first (single mode)");
+            } else if (knnEnroll(cmd + 7, embedding)) {
+                Serial.printf("Enrolled %s (%d examples)\n", cmd + 7, knnCount());
+            }
+        } else if (strcmp(cmd, "forget") == 0) {
+            knnClear();
+        } else if (strcmp(cmd, "knn") == 0) {
+            knnPrint();
+        } else {
+            Serial.println("Commands: enroll <name>, forget, knn");
+        }
+    }
+}
+
+void appSetup() {
+    Serial.begin(115200);
+    Serial.println("UNIHIKER K10 Fridge Manager Starting...");
+    bootMark("serial");
+
+    // Initialize hardware (screen, canvas, button callbacks)
+    halInit();
+    bootMark("screen");
+
+    // Inventory buffers and the list renderer (PSRAM)
+    ingredients = (Ingredient*)ps_malloc(MAX_INGREDIENTS * sizeof(Ingredient));
+    fetchBuffer = (Ingredient*)ps_malloc(MAX_INGREDIENTS * sizeof(Ingredient));
+    if (ingredients == nullptr || fetchBuffer == nullptr) {
+        Serial.println("Failed to allocate inventory in PSRAM!");
+        halDisplayClear();
+        halDisplayTextLine("Memory error!", 3, 0xFF0000);
+        halDisplayTextLine("Inventory buffers", 4, 0xFFFFFF);
+        halDisplayUpdate();
+        appHalted = true;
+        return;
+    }
+    textRendererInit();
+    scrollListInit(0, LIST_Y, 240, LIST_HEIGHT, LIST_ROW_HEIGHT,
+                   LIST_ROW_COLOR_EVEN, drawInventoryRow);
+
+    // Show cached inventory (or loading screen) right away
+    spiffsReady = SPIFFS.begin(true);
+    dataLoaded = loadInventoryCache();
+    dataFromCache = dataLoaded;
+    drawInventoryUI();
+    bootMark(dataLoaded ? "first frame (cached)" : "first frame (loading)");
+
+    // Register every resident model, then load them all in the background
+    classifierRegister();
+    halStartTask(classifierTask, "classifier", nullptr);
+
+    apiClientBegin(serverUrl);
+
+    // Start connecting to WiFi, bootStep() picks it up from loop()
+    Serial.printf("Connecting to WiFi: %s\n", ssid);
+    halNetworkBegin(ssid, password);
+    bootStateStart = millis();
+}
+
+void appLoop() {
+    if (appHalted) {
+        delay(1000);
+        return;
+    }
+
+    handleSerialCommand();
+
+    if (!bootTimelinePrinted) {
+        bootStep();
+    }
+
+    if (bootState != BOOT_DONE) {
+        delay(50);
+        return;
+    }
+
+    // Auto-refresh inventory every 30 seconds (only in inventory mode)
+    if (currentMode == MODE_INVENTORY && millis() - lastInventoryUpdate > 30000) {
+        heapMonitorBeginCycle("refresh");
+        if (fetchIngredients()) {
+            dataLoaded = true;
+            drawInventoryUI();
+        }
+        heapMonitorEndCycle();
+        lastInventoryUpdate = millis();
+    }
+
+    delay(100);
+}
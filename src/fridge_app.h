@@ -0,0 +1,25 @@
+/*
+ * Fridge App
+ *
+ * Application logic shared by the K10 firmware (main.cpp) and the Linux
+ * simulator (sim/sim_main.cpp).
+ */
+
+#ifndef FRIDGE_APP_H
+#define FRIDGE_APP_H
+
+// API base URL (set before appSetup() to use another server)
+extern const char* serverUrl;
+
+// Call once at startup
+void appSetup();
+
+// Call repeatedly from the main loop
+void appLoop();
+
+// Button handlers (wired to the board buttons by the HAL)
+void appButtonA();
+void appButtonB();
+void appButtonAB();
+
+#endif // FRIDGE_APP_H
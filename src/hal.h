@@ -0,0 +1,112 @@
+/*
+ * Hardware Abstraction Layer
+ *
+ * Everything the fridge app needs from the board: display, camera, LED,
+ * WiFi/time, the raw network connection used by api_client, and background
+ * tasks. hal_k10.cpp implements it on the UNIHIKER K10; sim/hal_sim.cpp
+ * implements it on Linux with a virtual clock so the app runs unmodified
+ * on the host. Buttons call appButtonA/B/AB() (fridge_app.h) directly.
+ */
+
+#ifndef HAL_H
+#define HAL_H
+
+#include <Arduino.h>
+#include <time.h>
+
+// Initialize board hardware (screen, canvas, button callbacks)
+void halInit();
+
+// ---- Display (240x320 canvas) ----
+
+// Clear the whole canvas
+void halDisplayClear();
+
+// Clear one text line (line layout used by halDisplayTextLine)
+void halDisplayClearLine(int line);
+
+// Set the screen background color (0xRRGGBB)
+void halDisplayBackground(uint32_t color);
+
+// Filled rectangle
+void halDisplayRect(int x, int y, int width, int height, uint32_t color);
+
+// Text at pixel position in the 24px font, drawn over the current content
+// maxChars: wrap width in characters
+void halDisplayText(const char* text, int x, int y, uint32_t color, int maxChars);
+
+// Text on a numbered line (1 = top)
+void halDisplayTextLine(const char* text, int line, uint32_t color);
+
+// Copy an RGB565 block (width x height pixels, row-major) onto the canvas
+void halDisplayBlit(int x, int y, int width, int height, const uint16_t* pixels);
+
+// Push canvas to the screen
+void halDisplayUpdate();
+
+// ---- Camera (RGB565, 2 bytes per pixel) ----
+
+struct HalFrame {
+    uint8_t* buf;
+    size_t len;
+    int width;
+    int height;
+};
+
+// Initialize the camera (call once before the first preview/capture)
+bool halCameraInit();
+
+// Show / hide live camera preview behind the canvas
+void halCameraPreview(bool on);
+
+// Capture one frame (nullptr on failure), release with halCameraRelease()
+HalFrame* halCameraCapture();
+void halCameraRelease(HalFrame* frame);
+
+// ---- LED ----
+
+void halLed(uint8_t r, uint8_t g, uint8_t b);
+
+// ---- WiFi / time ----
+
+// Start connecting (returns immediately)
+void halNetworkBegin(const char* ssid, const char* password);
+bool halNetworkConnected();
+
+// Local IP address as text
+const char* halNetworkAddress();
+
+// Start NTP sync (returns immediately, poll halTime() for a valid epoch)
+void halTimeSyncBegin();
+
+// Wall-clock time (seconds since epoch)
+time_t halTime();
+
+// ---- Network connection (one stream, used by api_client) ----
+
+// Connect to host:port; secure selects TLS (certificate not verified)
+bool halNetConnect(const char* host, uint16_t port, bool secure);
+bool halNetConnected();
+void halNetStop();
+size_t halNetWrite(const uint8_t* data, size_t len);
+
+// Read up to len bytes, waiting up to timeoutMs for them
+size_t halNetRead(char* buffer, size_t len, uint32_t timeoutMs);
+
+// Read until terminator (not stored) or len bytes, waiting up to timeoutMs
+size_t halNetReadUntil(char terminator, char* buffer, size_t len, uint32_t timeoutMs);
+
+// Mutex for the stream and the api_client buffers, which the main loop and
+// background tasks share (taken through apiLock())
+void halNetLock();
+void halNetUnlock();
+
+// ---- Misc ----
+
+// Run fn(param) in the background (second core on the K10)
+void halStartTask(void (*fn)(void*), const char* name, void* param);
+
+// Random integer in [minValue, maxValue)
+long halRandom(long minValue, long maxValue);
+
+#endif // HAL_H
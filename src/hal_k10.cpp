@@ -0,0 +1,202 @@
+/*
+ * HAL implementation for the UNIHIKER K10
+ */
+
+#include "hal.h"
+#include "fridge_app.h"
+#include "unihiker_k10.h"
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
+#include <esp_camera.h>
+
+UNIHIKER_K10 k10;
+uint8_t screen_dir = 0;  // 0=0°, 1=90°, 2=180°, 3=270°
+
+static SemaphoreHandle_t netMutex = nullptr;
+
+void halInit() {
+    netMutex = xSemaphoreCreateMutex();
+
+    k10.begin();
+    k10.initScreen(screen_dir);
+    k10.creatCanvas();
+
+    k10.buttonA->setPressedCallback(appButtonA);
+    k10.buttonB->setPressedCallback(appButtonB);
+    k10.buttonAB->setPressedCallback(appButtonAB);
+}
+
+// ---- Display ----
+
+void halDisplayClear() {
+    k10.canvas->canvasClear();
+}
+
+void halDisplayClearLine(int line) {
+    k10.canvas->canvasClear(line);
+}
+
+void halDisplayBackground(uint32_t color) {
+    k10.setScreenBackground(color);
+}
+
+void halDisplayRect(int x, int y, int width, int height, uint32_t color) {
+    k10.canvas->canvasRectangle(x, y, width, height, color, color, true);
+}
+
+void halDisplayText(const char* text, int x, int y, uint32_t color, int maxChars) {
+    // autoClean=false keeps whatever is drawn underneath
+    k10.canvas->canvasText(text, x, y, color, Canvas::eCNAndENFont24, maxChars, false);
+}
+
+void halDisplayTextLine(const char* text, int line, uint32_t color) {
+    k10.canvas->canvasText(text, line, color);
+}
+
+void halDisplayBlit(int x, int y, int width, int height, const uint16_t* pixels) {
+    k10.canvas->canvasDrawBitmap(x, y, width, height, (const uint8_t*)pixels);
+}
+
+void halDisplayUpdate() {
+    k10.canvas->updateCanvas();
+}
+
+// ---- Camera ----
+
+// esp_camera owns the frame buffers, HalFrame just points into the current one
+static camera_fb_t* currentFb = nullptr;
+static HalFrame currentFrame;
+
+bool halCameraInit() {
+    k10.initBgCamerImage();
+
+    // Flip camera 180° (board is mounted upside down)
+    sensor_t* sensor = esp_camera_sensor_get();
+    if (sensor) {
+        sensor->set_vflip(sensor, 1);
+        sensor->set_hmirror(sensor, 1);
+    }
+    return true;
+}
+
+void halCameraPreview(bool on) {
+    k10.setBgCamerImage(on);
+}
+
+HalFrame* halCameraCapture() {
+    currentFb = esp_camera_fb_get();
+    if (currentFb == nullptr) return nullptr;
+
+    currentFrame.buf = currentFb->buf;
+    currentFrame.len = currentFb->len;
+    currentFrame.width = currentFb->width;
+    currentFrame.height = currentFb->height;
+    return &currentFrame;
+}
+
+void halCameraRelease(HalFrame* frame) {
+    if (frame == &currentFrame && currentFb != nullptr) {
+        esp_camera_fb_return(currentFb);
+        currentFb = nullptr;
+    }
+}
+
+// ---- LED ----
+
+void halLed(uint8_t r, uint8_t g, uint8_t b) {
+    k10.rgb->write(0, r, g, b);
+}
+
+// ---- WiFi / time ----
+
+void halNetworkBegin(const char* ssid, const char* password) {
+    WiFi.begin(ssid, password);
+}
+
+bool halNetworkConnected() {
+    return WiFi.status() == WL_CONNECTED;
+}
+
+const char* halNetworkAddress() {
+    static char address[16];
+    IPAddress ip = WiFi.localIP();
+    snprintf(address, sizeof(address), "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+    return address;
+}
+
+void halTimeSyncBegin() {
+    configTime(0, 0, "pool.ntp.org", "time.nist.gov");
+}
+
+time_t halTime() {
+    return time(nullptr);
+}
+
+// ---- Network connection ----
+
+static WiFiClientSecure secureClient;
+static WiFiClient plainClient;
+static WiFiClient* netClient = &secureClient;
+
+bool halNetConnect(const char* host, uint16_t port, bool secure) {
+    if (secure) {
+        secureClient.setInsecure();
+        netClient = &secureClient;
+    } else {
+        netClient = &plainClient;
+    }
+    return netClient->connect(host, port);
+}
+
+bool halNetConnected() {
+    return netClient->connected();
+}
+
+void halNetStop() {
+    netClient->stop();
+}
+
+size_t halNetWrite(const uint8_t* data, size_t len) {
+    return netClient->write(data, len);
+}
+
+size_t halNetRead(char* buffer, size_t len, uint32_t timeoutMs) {
+    netClient->Stream::setTimeout(timeoutMs);  // WiFiClient::setTimeout takes seconds on some cores
+    return netClient->readBytes(buffer, len);
+}
+
+size_t halNetReadUntil(char terminator, char* buffer, size_t len, uint32_t timeoutMs) {
+    netClient->Stream::setTimeout(timeoutMs);
+    return netClient->readBytesUntil(terminator, buffer, len);
+}
+
+void halNetLock() {
+    xSemaphoreTake(netMutex, portMAX_DELAY);
+}
+
+void halNetUnlock() {
+    xSemaphoreGive(netMutex);
+}
+
+// ---- Misc ----
+
+struct TaskStart {
+    void (*fn)(void*);
+    void* param;
+};
+
+static void taskTrampoline(void* arg) {
+    TaskStart start = *(TaskStart*)arg;
+    delete (TaskStart*)arg;
+    start.fn(start.param);
+    vTaskDelete(nullptr);
+}
+
+void halStartTask(void (*fn)(void*), const char* name, void* param) {
+    // Core 0, next to the WiFi stack, leaves core 1 to the UI loop
+    xTaskCreatePinnedToCore(taskTrampoline, name, 8192, new TaskStart{fn, param}, 1, nullptr, 0);
+}
+
+long halRandom(long minValue, long maxValue) {
+    return random(minValue, maxValue);
+}
@@ -0,0 +1,184 @@
+/*
+ * Heap Monitor Implementation
+ *
+ * On the K10 this watches the internal 8-bit heap, which is where TLS
+ * buffers come from. On the host (simulator soak runs) it reads glibc's
+ * mallinfo2(). Allocation counting wraps malloc/calloc/realloc at link
+ * time (-Wl,--wrap=malloc etc., see platformio.ini).
+ */
+
+#include "heap_monitor.h"
+
+#ifdef ARDUINO
+#include <esp_heap_caps.h>
+#define HEAP_MONITOR_CAPS (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+#else
+#include <malloc.h>
+#include <new>
+#endif
+
+// Heap numbers common to both platforms
+struct HeapInfo {
+    size_t freeBytes;
+    size_t largestFreeBlock;
+    int allocatedBlocks;
+    int freeBlocks;
+};
+
+static size_t minFreeBytes = SIZE_MAX;
+
+static HeapStats lastStats = {"none", 0, 0, 0, 0, 0, 0, -1};
+static const char* currentCycle = "none";
+static uint32_t cycleCount = 0;
+static int cycleStartBlocks = 0;
+static long cycleStartAllocs = 0;
+static size_t worstLargestBlock = SIZE_MAX;
+
+#ifdef HEAP_MONITOR_COUNT_ALLOCS
+
+static volatile long allocCalls = 0;
+static volatile long liveBlocks = 0;
+
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t n, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void __real_free(void* ptr);
+
+void* __wrap_malloc(size_t size) {
+    __atomic_fetch_add(&allocCalls, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&liveBlocks, 1, __ATOMIC_RELAXED);
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t n, size_t size) {
+    __atomic_fetch_add(&allocCalls, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&liveBlocks, 1, __ATOMIC_RELAXED);
+    return __real_calloc(n, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+    __atomic_fetch_add(&allocCalls, 1, __ATOMIC_RELAXED);
+    if (ptr == nullptr) __atomic_fetch_add(&liveBlocks, 1, __ATOMIC_RELAXED);
+    return __real_realloc(ptr, size);
+}
+
+void __wrap_free(void* ptr) {
+    if (ptr != nullptr) __atomic_fetch_sub(&liveBlocks, 1, __ATOMIC_RELAXED);
+    __real_free(ptr);
+}
+}
+
+#ifndef ARDUINO
+// libstdc++ is a shared library on the host, so route new/delete through
+// the wrapped malloc/free to count C++ allocations too
+void* operator new(size_t size) {
+    void* ptr = malloc(size ? size : 1);
+    if (ptr == nullptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    free(ptr);
+}
+#endif // !ARDUINO
+
+long heapMonitorAllocCount() {
+    return __atomic_load_n(&allocCalls, __ATOMIC_RELAXED);
+}
+
+#else
+
+long heapMonitorAllocCount() {
+    return -1;
+}
+
+#endif // HEAP_MONITOR_COUNT_ALLOCS
+
+static void readHeap(HeapInfo& heap) {
+#ifdef ARDUINO
+    multi_heap_info_t info;
+    heap_caps_get_info(&info, HEAP_MONITOR_CAPS);
+    heap.freeBytes = info.total_free_bytes;
+    heap.largestFreeBlock = info.largest_free_block;
+    heap.allocatedBlocks = info.allocated_blocks;
+    heap.freeBlocks = info.free_blocks;
+#else
+    // glibc has no largest-free-block figure; the releasable top chunk is
+    // the closest stable proxy. Live blocks come from the malloc wrappers.
+    struct mallinfo2 info = mallinfo2();
+    heap.freeBytes = info.fordblks;
+    heap.largestFreeBlock = info.keepcost;
+#ifdef HEAP_MONITOR_COUNT_ALLOCS
+    heap.allocatedBlocks = (int)liveBlocks;
+#else
+    heap.allocatedBlocks = 0;
+#endif
+    heap.freeBlocks = (int)info.ordblks;
+#endif
+
+    if (heap.freeBytes < minFreeBytes) minFreeBytes = heap.freeBytes;
+}
+
+void heapMonitorBeginCycle(const char* name) {
+    HeapInfo heap;
+    readHeap(heap);
+
+    currentCycle = name;
+    cycleStartBlocks = heap.allocatedBlocks;
+    cycleStartAllocs = heapMonitorAllocCount();
+}
+
+void heapMonitorEndCycle() {
+    long allocsNow = heapMonitorAllocCount();
+
+    HeapInfo heap;
+    readHeap(heap);
+
+    lastStats.cycleName = currentCycle;
+    lastStats.cycle = ++cycleCount;
+    lastStats.freeBytes = heap.freeBytes;
+    lastStats.largestFreeBlock = heap.largestFreeBlock;
+#ifdef ARDUINO
+    lastStats.minFreeBytes = heap_caps_get_minimum_free_size(HEAP_MONITOR_CAPS);
+#else
+    lastStats.minFreeBytes = minFreeBytes;
+#endif
+    lastStats.freeBlocks = heap.freeBlocks;
+    lastStats.blockDelta = heap.allocatedBlocks - cycleStartBlocks;
+    lastStats.allocCount = allocsNow < 0 ? -1 : allocsNow - cycleStartAllocs;
+
+    if (heap.largestFreeBlock < worstLargestBlock) {
+        worstLargestBlock = heap.largestFreeBlock;
+    }
+
+    Serial.printf("[heap] #%u %s: free %u, largest %u (worst %u), min %u, frags %d, blocks %+d, allocs %ld\n",
+                  (unsigned)lastStats.cycle, lastStats.cycleName,
+                  (unsigned)lastStats.freeBytes, (unsigned)lastStats.largestFreeBlock,
+                  (unsigned)worstLargestBlock, (unsigned)lastStats.minFreeBytes,
+                  lastStats.freeBlocks, lastStats.blockDelta, lastStats.allocCount);
+}
+
+const HeapStats& heapMonitorLast() {
+    return lastStats;
+}
+
+size_t heapMonitorWorstLargestBlock() {
+    return worstLargestBlock;
+}
@@ -0,0 +1,42 @@
+/*
+ * Heap Monitor
+ *
+ * Tracks heap health per work cycle (inventory refresh, scan, ...) so
+ * long-running fragmentation shows up before TLS allocations start failing.
+ * Largest free block and free-list fragments come from the heap itself;
+ * malloc calls are counted when built with HEAP_MONITOR_COUNT_ALLOCS.
+ */
+
+#ifndef HEAP_MONITOR_H
+#define HEAP_MONITOR_H
+
+#include <Arduino.h>
+
+// Heap statistics for one cycle
+struct HeapStats {
+    const char* cycleName;      // Name passed to heapMonitorBeginCycle
+    uint32_t cycle;             // Cycle number since boot
+    size_t freeBytes;           // Free heap at end of cycle
+    size_t largestFreeBlock;    // Largest allocatable block at end of cycle
+    size_t minFreeBytes;        // Lowest free heap seen since boot
+    int freeBlocks;             // Free-list fragments at end of cycle
+    int blockDelta;             // Net blocks still allocated after the cycle
+    long allocCount;            // malloc/calloc/realloc calls during the cycle (-1 if not counted)
+};
+
+// Start measuring a cycle (name: string literal)
+void heapMonitorBeginCycle(const char* name);
+
+// Finish the cycle, update stats and print them to Serial
+void heapMonitorEndCycle();
+
+// Stats of the last finished cycle
+const HeapStats& heapMonitorLast();
+
+// Smallest largest-free-block seen at the end of any cycle
+size_t heapMonitorWorstLargestBlock();
+
+// Total allocation calls since boot (-1 if not counted)
+long heapMonitorAllocCount();
+
+#endif // HEAP_MONITOR_H
@@ -0,0 +1,268 @@
+/*
+ * kNN Index Implementation
+ *
+ * Embeddings are L2-normalized int8 (127 = 1.0), so cosine similarity is a
+ * plain int8 dot product. Rows are padded to a multiple of 16 bytes and
+ * scanned with a 4-way unrolled int32 accumulation, so a few hundred
+ * entries are searched in well under a millisecond.
+ *
+ * File format: "KNN1", uint16 dim, then records of
+ * { char label[KNN_LABEL_LEN]; int8_t vector[dim]; }
+ * An example is appended to the file before it is added in memory, and a
+ * partly written record is dropped by rewriting the file from memory.
+ */
+
+#include "knn_index.h"
+#include <SPIFFS.h>
+
+static const char KNN_MAGIC[4] = {'K', 'N', 'N', '1'};
+#define KNN_HEADER_SIZE (sizeof(KNN_MAGIC) + sizeof(uint16_t))
+
+static int knnDim = 0;
+static int knnStride = 0;              // Row length in bytes (dim padded to 16)
+static int8_t* vectors = nullptr;      // KNN_MAX_ENTRIES rows + 1 query row in PSRAM
+static uint8_t labelIds[KNN_MAX_ENTRIES];
+static char labels[KNN_MAX_LABELS][KNN_LABEL_LEN];
+static int numEntries = 0;
+static int numLabels = 0;
+
+// Id of a label, -1 if it is not in the table
+static int findLabel(const char* label) {
+    for (int i = 0; i < numLabels; i++) {
+        if (strncmp(labels[i], label, KNN_LABEL_LEN) == 0) return i;
+    }
+    return -1;
+}
+
+// Whether one more example with this label fits in memory
+static bool canAdd(const char* label) {
+    if (numEntries >= KNN_MAX_ENTRIES) {
+        Serial.println("kNN index full");
+        return false;
+    }
+    if (findLabel(label) < 0 && numLabels >= KNN_MAX_LABELS) {
+        Serial.println("kNN label table full");
+        return false;
+    }
+    return true;
+}
+
+// Add to memory only
+static bool addEntry(const char* label, const int8_t* embedding) {
+    if (!canAdd(label)) return false;
+
+    int id = findLabel(label);
+    if (id < 0) {
+        strlcpy(labels[numLabels], label, KNN_LABEL_LEN);
+        id = numLabels++;
+    }
+
+    int8_t* row = vectors + numEntries * knnStride;
+    memcpy(row, embedding, knnDim);
+    memset(row + knnDim, 0, knnStride - knnDim);
+    labelIds[numEntries++] = id;
+    return true;
+}
+
+// Dot product of two padded rows (length is a multiple of 16)
+static int32_t dot(const int8_t* a, const int8_t* b, int len) {
+    int32_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int i = 0; i < len; i += 4) {
+        s0 += a[i] * b[i];
+        s1 += a[i + 1] * b[i + 1];
+        s2 += a[i + 2] * b[i + 2];
+        s3 += a[i + 3] * b[i + 3];
+    }
+    return s0 + s1 + s2 + s3;
+}
+
+static bool writeHeader(File& f) {
+    uint16_t dim = knnDim;
+    return f.write((const uint8_t*)KNN_MAGIC, 4) == 4 &&
+           f.write((const uint8_t*)&dim, sizeof(dim)) == sizeof(dim);
+}
+
+static bool writeRecord(File& f, const char* label, const int8_t* embedding) {
+    char paddedLabel[KNN_LABEL_LEN] = {0};
+    strlcpy(paddedLabel, label, KNN_LABEL_LEN);
+
+    return f.write((const uint8_t*)paddedLabel, KNN_LABEL_LEN) == KNN_LABEL_LEN &&
+           f.write((const uint8_t*)embedding, knnDim) == (size_t)knnDim;
+}
+
+// Rewrite the index file from memory
+static bool saveIndex() {
+    File f = SPIFFS.open(KNN_INDEX_PATH, FILE_WRITE);
+    if (!f) return false;
+
+    bool ok = writeHeader(f);
+    for (int i = 0; ok && i < numEntries; i++) {
+        ok = writeRecord(f, labels[labelIds[i]], vectors + i * knnStride);
+    }
+    f.close();
+    return ok;
+}
+
+static void loadIndex() {
+    File f = SPIFFS.open(KNN_INDEX_PATH, FILE_READ);
+    if (!f) return;
+
+    char magic[4];
+    uint16_t dim = 0;
+    if (f.read((uint8_t*)magic, 4) != 4 || memcmp(magic, KNN_MAGIC, 4) != 0 ||
+        f.read((uint8_t*)&dim, sizeof(dim)) != sizeof(dim)) {
+        Serial.println("kNN index file corrupt, ignoring");
+        f.close();
+        return;
+    }
+    if (dim != knnDim) {
+        // Model changed, old embeddings are meaningless
+        Serial.printf("kNN index is for dim %d, model has %d - discarding\n", dim, knnDim);
+        f.close();
+        SPIFFS.remove(KNN_INDEX_PATH);
+        return;
+    }
+
+    // A record cut short by a failed write or power loss
+    size_t recordSize = KNN_LABEL_LEN + knnDim;
+    size_t fileSize = f.size();
+    bool partial = fileSize < KNN_HEADER_SIZE || (fileSize - KNN_HEADER_SIZE) % recordSize != 0;
+
+    char label[KNN_LABEL_LEN];
+    int8_t* scratch = vectors + numEntries * knnStride;
+    while (numEntries < KNN_MAX_ENTRIES &&
+           f.read((uint8_t*)label, KNN_LABEL_LEN) == KNN_LABEL_LEN &&
+           f.read((uint8_t*)scratch, knnDim) == (size_t)knnDim) {
+        label[KNN_LABEL_LEN - 1] = '\0';
+        addEntry(label, scratch);
+        scratch = vectors + numEntries * knnStride;
+    }
+    f.close();
+
+    if (partial) {
+        Serial.println("kNN index file has a partial record, rewriting");
+        if (!saveIndex()) Serial.println("Failed to write kNN index file");
+    }
+}
+
+bool knnInit(int dim) {
+    if (dim <= 0) return false;
+
+    knnDim = dim;
+    knnStride = (dim + 15) & ~15;
+    numEntries = 0;
+    numLabels = 0;
+
+    if (vectors == nullptr) {
+        vectors = (int8_t*)ps_malloc((KNN_MAX_ENTRIES + 1) * knnStride);
+        if (vectors == nullptr) {
+            Serial.println("Failed to allocate kNN index in PSRAM!");
+            return false;
+        }
+    }
+
+    loadIndex();
+    Serial.printf("kNN index: %d examples, %d labels, dim=%d\n", numEntries, numLabels, knnDim);
+    return true;
+}
+
+bool knnEnroll(const char* label, const int8_t* embedding) {
+    if (vectors == nullptr || !canAdd(label)) return false;
+
+    // Flash first, so memory never holds an example the file lost
+    bool fresh = !SPIFFS.exists(KNN_INDEX_PATH);
+    File f = SPIFFS.open(KNN_INDEX_PATH, FILE_APPEND);
+    if (!f) {
+        Serial.println("Failed to open kNN index file");
+        return false;
+    }
+
+    bool ok = (!fresh || writeHeader(f)) && writeRecord(f, label, embedding);
+    f.close();
+
+    if (!ok) {
+        Serial.println("Failed to write kNN index file");
+        saveIndex();  // Drop the partial record so later appends stay aligned
+        return false;
+    }
+    return addEntry(label, embedding);
+}
+
+KnnMatch knnLookup(const int8_t* embedding) {
+    KnnMatch match = {nullptr, 0.0f, 0, false};
+    if (vectors == nullptr || numEntries == 0) return match;
+
+    // Query padded the same way as the rows
+    int8_t* query = vectors + KNN_MAX_ENTRIES * knnStride;
+    memcpy(query, embedding, knnDim);
+    memset(query + knnDim, 0, knnStride - knnDim);
+
+    // Top-K by dot product (insertion into a tiny sorted list)
+    int32_t bestScore[KNN_K] = {0};
+    int bestEntry[KNN_K] = {0};
+    int found = 0;
+
+    const int8_t* row = vectors;
+    for (int i = 0; i < numEntries; i++, row += knnStride) {
+        int32_t score = dot(query, row, knnStride);
+
+        int pos = found < KNN_K ? found++ : KNN_K;
+        while (pos > 0 && bestScore[pos - 1] < score) {
+            if (pos < KNN_K) {
+                bestScore[pos] = bestScore[pos - 1];
+                bestEntry[pos] = bestEntry[pos - 1];
+            }
+            pos--;
+        }
+        if (pos < KNN_K) {
+            bestScore[pos] = score;
+            bestEntry[pos] = i;
+        }
+    }
+
+    // Similarity-weighted vote among the neighbours
+    float weight[KNN_MAX_LABELS] = {0};
+    int votes[KNN_MAX_LABELS] = {0};
+    int winner = labelIds[bestEntry[0]];
+    for (int k = 0; k < found; k++) {
+        int id = labelIds[bestEntry[k]];
+        weight[id] += bestScore[k];
+        votes[id]++;
+        if (weight[id] > weight[winner]) winner = id;
+    }
+
+    // Best neighbour of the winning label
+    for (int k = 0; k < found; k++) {
+        if (labelIds[bestEntry[k]] == winner) {
+            match.similarity = bestScore[k] / (127.0f * 127.0f);
+            break;
+        }
+    }
+
+    match.label = labels[winner];
+    match.votes = votes[winner];
+    match.valid = match.similarity >= KNN_MIN_SIMILARITY;
+    return match;
+}
+
+void knnClear() {
+    numEntries = 0;
+    numLabels = 0;
+    SPIFFS.remove(KNN_INDEX_PATH);
+    Serial.println("kNN index cleared");
+}
+
+int knnCount() {
+    return numEntries;
+}
+
+void knnPrint() {
+    Serial.printf("kNN index: %d/%d examples, dim=%d\n", numEntries, KNN_MAX_ENTRIES, knnDim);
+    for (int id = 0; id < numLabels; id++) {
+        int count = 0;
+        for (int i = 0; i < numEntries; i++) {
+            if (labelIds[i] == id) count++;
+        }
+        Serial.printf("  %s: %d\n", labels[id], count);
+    }
+}
@@ -0,0 +1,52 @@
+/*
+ * kNN Index for user-enrolled produce
+ *
+ * Stores int8 embeddings from the classifier's penultimate layer together
+ * with a user label, so new items can be recognized without retraining.
+ * Vectors live in PSRAM and are persisted to SPIFFS as an append-only file.
+ */
+
+#ifndef KNN_INDEX_H
+#define KNN_INDEX_H
+
+#include <Arduino.h>
+
+#define KNN_MAX_ENTRIES 512
+#define KNN_MAX_LABELS 64
+#define KNN_LABEL_LEN 24
+#define KNN_INDEX_PATH "/knn_index.bin"
+
+// Neighbours that vote on a lookup
+#define KNN_K 3
+
+// Minimum cosine similarity of the best neighbour for a match
+#define KNN_MIN_SIMILARITY 0.80f
+
+// Lookup result
+struct KnnMatch {
+    const char* label;     // Enrolled label (valid until knnClear)
+    float similarity;      // Cosine similarity of the best neighbour with this label
+    int votes;             // Neighbours (of KNN_K) that agreed
+    bool valid;            // Whether a label passed KNN_MIN_SIMILARITY
+};
+
+// Allocate the index for embeddings of length dim and load it from SPIFFS
+// (SPIFFS must already be mounted)
+bool knnInit(int dim);
+
+// Add an example and append it to the index file
+bool knnEnroll(const char* label, const int8_t* embedding);
+
+// Find the best matching label for an embedding
+KnnMatch knnLookup(const int8_t* embedding);
+
+// Remove all examples (memory and SPIFFS)
+void knnClear();
+
+// Number of enrolled examples
+int knnCount();
+
+// Print enrolled labels and counts to Serial
+void knnPrint();
+
+#endif // KNN_INDEX_H
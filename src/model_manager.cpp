@@ -0,0 +1,235 @@
+/*
+ * Model Manager Implementation
+ *
+ * Uses the two-arena MicroAllocator: a per-model persistent buffer and a
+ * non-persistent buffer that every interpreter plans its activations into.
+ * Only one model runs at a time, so their activations may overlap.
+ */
+
+#include "model_manager.h"
+
+#include <Chirale_TensorFlowLite.h>
+#include <tensorflow/lite/micro/all_ops_resolver.h>
+#include <tensorflow/lite/micro/micro_allocator.h>
+#include <tensorflow/lite/micro/micro_interpreter.h>
+#include <tensorflow/lite/schema/schema_generated.h>
+
+// One resident model
+struct ResidentModel {
+    const char* name;
+    const unsigned char* data;
+    size_t persistentSize;
+    size_t scratchSize;
+    tflite::MicroProfilerInterface* profiler;
+    uint8_t* persistentArena;
+    size_t persistentUsed;
+    size_t scratchUsed;
+    tflite::MicroInterpreter* interpreter;
+    bool ready;
+};
+
+// Persistent arenas are pre-filled with this byte so the part the allocator
+// touched can be measured after AllocateTensors()
+#define ARENA_FILL_BYTE 0xA5
+
+// Warn when a model's persistent arena has less headroom than this
+#define PERSISTENT_HEADROOM_WARN (8 * 1024)
+
+// Warn when the shared scratch arena has less headroom than this over a model
+#define SCRATCH_HEADROOM_WARN (16 * 1024)
+
+static tflite::AllOpsResolver mmOpsResolver;
+static ResidentModel models[MAX_RESIDENT_MODELS];
+static int numModels = 0;
+static int activeModel = -1;
+static uint8_t* scratchArena = nullptr;
+static size_t scratchArenaSize = 0;
+
+int modelManagerRegister(const char* name, const unsigned char* modelData,
+                         size_t persistentSize, size_t scratchSize,
+                         tflite::MicroProfilerInterface* profiler) {
+    if (scratchArena != nullptr) {
+        Serial.printf("Cannot register %s: model manager already started\n", name);
+        return -1;
+    }
+    if (numModels >= MAX_RESIDENT_MODELS) {
+        Serial.printf("Cannot register %s: model table full\n", name);
+        return -1;
+    }
+
+    ResidentModel& m = models[numModels];
+    m.name = name;
+    m.data = modelData;
+    m.persistentSize = persistentSize;
+    m.scratchSize = scratchSize;
+    m.profiler = profiler;
+    m.persistentArena = nullptr;
+    m.persistentUsed = 0;
+    m.scratchUsed = 0;
+    m.interpreter = nullptr;
+    m.ready = false;
+
+    return numModels++;
+}
+
+// Free whatever loadModel() allocated for a model that failed to load
+static void unloadModel(ResidentModel& m) {
+    delete m.interpreter;
+    m.interpreter = nullptr;
+    free(m.persistentArena);
+    m.persistentArena = nullptr;
+    m.persistentUsed = 0;
+    m.scratchUsed = 0;
+}
+
+// Bytes of the persistent arena the allocator wrote to. TFLM allocates
+// persistent buffers downwards from the end of the arena, so everything
+// above the first byte that no longer holds the fill pattern is in use.
+static size_t persistentHighWater(const ResidentModel& m) {
+    size_t untouched = 0;
+    while (untouched < m.persistentSize && m.persistentArena[untouched] == ARENA_FILL_BYTE) {
+        untouched++;
+    }
+    return m.persistentSize - untouched;
+}
+
+// Bytes of the shared scratch arena the model's activations need. Planned
+// buffers are not written until Invoke(), so a fill pattern would miss them;
+// the planner's size is what arena_used_bytes() reports on top of the
+// persistent tail.
+static size_t scratchHighWater(const ResidentModel& m) {
+    size_t used = m.interpreter->arena_used_bytes();
+    return used > m.persistentUsed ? used - m.persistentUsed : 0;
+}
+
+// Allocate persistent arena and tensors for one model
+static bool loadModel(ResidentModel& m) {
+    const tflite::Model* model = tflite::GetModel(m.data);
+    if (model->version() != TFLITE_SCHEMA_VERSION) {
+        Serial.printf("%s: model schema mismatch: %d vs %d\n", m.name, model->version(), TFLITE_SCHEMA_VERSION);
+        return false;
+    }
+
+    m.persistentArena = (uint8_t*)ps_malloc(m.persistentSize);
+    if (m.persistentArena == nullptr) {
+        Serial.printf("%s: failed to allocate persistent arena\n", m.name);
+        return false;
+    }
+    memset(m.persistentArena, ARENA_FILL_BYTE, m.persistentSize);
+
+    // The allocator object itself lives in the persistent arena
+    tflite::MicroAllocator* allocator = tflite::MicroAllocator::Create(
+        m.persistentArena, m.persistentSize, scratchArena, scratchArenaSize);
+    if (allocator == nullptr) {
+        Serial.printf("%s: failed to create allocator\n", m.name);
+        unloadModel(m);
+        return false;
+    }
+
+    m.interpreter = new tflite::MicroInterpreter(model, mmOpsResolver, allocator, nullptr, m.profiler);
+
+    if (m.interpreter->AllocateTensors() != kTfLiteOk) {
+        Serial.printf("%s: failed to allocate tensors! (persistent arena %d KB)\n",
+                      m.name, (int)(m.persistentSize / 1024));
+        unloadModel(m);
+        return false;
+    }
+
+    m.persistentUsed = persistentHighWater(m);
+    if (m.persistentSize - m.persistentUsed < PERSISTENT_HEADROOM_WARN) {
+        Serial.printf("%s: persistent arena nearly full: %d of %d bytes used\n",
+                      m.name, (int)m.persistentUsed, (int)m.persistentSize);
+    }
+
+    m.scratchUsed = scratchHighWater(m);
+    if (scratchArenaSize - m.scratchUsed < SCRATCH_HEADROOM_WARN) {
+        Serial.printf("%s: shared scratch arena nearly full: %d of %d bytes used\n",
+                      m.name, (int)m.scratchUsed, (int)scratchArenaSize);
+    }
+
+    return true;
+}
+
+bool modelManagerBegin() {
+    if (scratchArena != nullptr) return true;
+    if (numModels == 0) return false;
+
+    // Shared scratch arena is sized to the largest model
+    for (int i = 0; i < numModels; i++) {
+        if (models[i].scratchSize > scratchArenaSize) {
+            scratchArenaSize = models[i].scratchSize;
+        }
+    }
+
+    scratchArena = (uint8_t*)ps_malloc(scratchArenaSize);
+    if (scratchArena == nullptr) {
+        Serial.println("Failed to allocate shared scratch arena in PSRAM!");
+        scratchArenaSize = 0;
+        return false;
+    }
+    Serial.printf("Allocated %d KB shared scratch arena in PSRAM\n", (int)(scratchArenaSize / 1024));
+
+    bool anyReady = false;
+    for (int i = 0; i < numModels; i++) {
+        models[i].ready = loadModel(models[i]);
+        anyReady = anyReady || models[i].ready;
+    }
+
+    modelManagerPrintBudgets();
+    return anyReady;
+}
+
+tflite::MicroInterpreter* modelManagerSelect(int handle) {
+    if (!modelManagerIsReady(handle)) return nullptr;
+
+    if (activeModel != handle) {
+        activeModel = handle;
+        Serial.printf("Active model: %s\n", models[handle].name);
+    }
+    return models[handle].interpreter;
+}
+
+int modelManagerActive() {
+    return activeModel;
+}
+
+bool modelManagerIsReady(int handle) {
+    return handle >= 0 && handle < numModels && models[handle].ready;
+}
+
+bool modelManagerGetBudget(int handle, ModelBudget& budget) {
+    if (handle < 0 || handle >= numModels) return false;
+
+    const ResidentModel& m = models[handle];
+    budget.name = m.name;
+    budget.persistentSize = m.persistentSize;
+    budget.scratchSize = m.scratchSize;
+    budget.persistentUsed = m.persistentUsed;
+    budget.scratchUsed = m.scratchUsed;
+    budget.usedBytes = m.ready ? m.interpreter->arena_used_bytes() : 0;
+    budget.ready = m.ready;
+    return true;
+}
+
+size_t modelManagerScratchSize() {
+    return scratchArenaSize;
+}
+
+void modelManagerPrintBudgets() {
+    size_t totalPersistent = 0;
+
+    Serial.println("Model memory budget:");
+    for (int i = 0; i < numModels; i++) {
+        ModelBudget b;
+        modelManagerGetBudget(i, b);
+        totalPersistent += b.persistentSize;
+        Serial.printf("  %s: persistent %d KB (%d bytes used), scratch %d KB (%d bytes used, %d KB headroom), used %d KB%s\n",
+                      b.name, (int)(b.persistentSize / 1024), (int)b.persistentUsed,
+                      (int)(b.scratchSize / 1024), (int)b.scratchUsed,
+                      (int)((scratchArenaSize - b.scratchUsed) / 1024), (int)(b.usedBytes / 1024),
+                      b.ready ? "" : " (NOT READY)");
+    }
+    Serial.printf("  total: %d KB (%d KB persistent + %d KB shared scratch)\n",
+                  (int)((totalPersistent + scratchArenaSize) / 1024),
+                  (int)(totalPersistent / 1024), (int)(scratchArenaSize / 1024));
+}
@@ -0,0 +1,72 @@
+/*
+ * Model Manager
+ *
+ * Keeps several TFLite Micro models resident at the same time.
+ * Each model gets its own small persistent arena (interpreter state,
+ * tensor metadata, quantization data) while all models share one
+ * non-persistent scratch arena for activations, sized to the largest model.
+ * Tensors are allocated once in modelManagerBegin(), so switching models
+ * never re-runs AllocateTensors().
+ */
+
+#ifndef MODEL_MANAGER_H
+#define MODEL_MANAGER_H
+
+#include <Arduino.h>
+
+namespace tflite {
+class MicroInterpreter;
+class MicroProfilerInterface;
+}
+
+// Maximum number of models that can be registered
+#define MAX_RESIDENT_MODELS 4
+
+// Memory budget of one model
+struct ModelBudget {
+    const char* name;          // Name given at registration
+    size_t persistentSize;     // Bytes reserved for the model's persistent arena
+    size_t persistentUsed;     // Bytes of it written by AllocateTensors (high-water mark)
+    size_t scratchSize;        // Activation bytes the model declared it needs
+    size_t scratchUsed;        // Activation bytes the planner laid out in the shared arena
+    size_t usedBytes;          // Persistent + scratch bytes used after AllocateTensors
+    bool ready;                // Whether tensors were allocated successfully
+};
+
+// Register a model (call before modelManagerBegin)
+// modelData: TFLite flatbuffer
+// persistentSize: bytes for this model's own persistent arena
+// scratchSize: activation bytes needed, the shared arena is the max of these
+// profiler: optional per-op hook passed to the interpreter
+// Returns model handle, or -1 if the table is full
+int modelManagerRegister(const char* name, const unsigned char* modelData,
+                         size_t persistentSize, size_t scratchSize,
+                         tflite::MicroProfilerInterface* profiler = nullptr);
+
+// Allocate all arenas in PSRAM and allocate tensors for every registered model
+// Call once, after every model has been registered
+// Returns true if at least one model is ready
+bool modelManagerBegin();
+
+// Make a model the active one and return its interpreter
+// Inputs of the previously active model live in the shared scratch arena,
+// so they must be written again after switching before calling Invoke().
+// Returns nullptr if the model is not ready
+tflite::MicroInterpreter* modelManagerSelect(int handle);
+
+// Currently active model handle (-1 if none)
+int modelManagerActive();
+
+// Check if a model's tensors are allocated
+bool modelManagerIsReady(int handle);
+
+// Get memory budget of a model
+bool modelManagerGetBudget(int handle, ModelBudget& budget);
+
+// Size of the shared scratch arena
+size_t modelManagerScratchSize();
+
+// Print memory budget of all models to Serial
+void modelManagerPrintBudgets();
+
+#endif // MODEL_MANAGER_H
@@ -0,0 +1,76 @@
+/*
+ * Multi-item scan helpers
+ *
+ * Region layout and item deduplication. Independent of the inference
+ * backend, so the simulator shares them with the device build.
+ */
+
+#include "vegetable_classifier.h"
+
+int makeGridRegions(int width, int height, int cols, int rows, ImageRegion* regions) {
+    int count = 0;
+    if (cols < 1 || rows < 1) return 0;
+
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            if (count >= MAX_SCAN_REGIONS) return count;
+            // Step is half a region, so neighbours overlap by 50%
+            int x0 = c * width / (cols + 1);
+            int y0 = r * height / (rows + 1);
+            int x1 = (c + 2) * width / (cols + 1);
+            int y1 = (r + 2) * height / (rows + 1);
+            regions[count++] = {x0, y0, x1 - x0, y1 - y0};
+        }
+    }
+    return count;
+}
+
+// Regions that share some area (regions that only meet at an edge or a
+// corner do not)
+static bool regionsOverlap(const ImageRegion& a, const ImageRegion& b) {
+    return a.x < b.x + b.width && b.x < a.x + a.width &&
+           a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+// Union-find root lookup for item deduplication
+static int findRoot(int* parent, int i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+void countScanItems(MultiScanResult& out, float minConfidence) {
+    int parent[MAX_SCAN_REGIONS];
+    bool counted[MAX_SCAN_REGIONS];
+
+    for (int i = 0; i < out.numRegions; i++) {
+        parent[i] = i;
+        counted[i] = out.results[i].valid &&
+                     out.results[i].classIndex != NONE_CLASS_INDEX &&
+                     out.results[i].confidence >= minConfidence;
+    }
+
+    for (int i = 0; i < out.numRegions; i++) {
+        if (!counted[i]) continue;
+        for (int j = i + 1; j < out.numRegions; j++) {
+            if (!counted[j]) continue;
+            if (out.results[i].classIndex != out.results[j].classIndex) continue;
+            if (!regionsOverlap(out.regions[i], out.regions[j])) continue;
+            parent[findRoot(parent, j)] = findRoot(parent, i);
+        }
+    }
+
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        out.itemCounts[i] = 0;
+    }
+    out.totalItems = 0;
+
+    for (int i = 0; i < out.numRegions; i++) {
+        if (counted[i] && findRoot(parent, i) == i) {
+            out.itemCounts[out.results[i].classIndex]++;
+            out.totalItems++;
+        }
+    }
+}
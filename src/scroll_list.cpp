@@ -0,0 +1,130 @@
+/*
+ * Scroll List Implementation
+ */
+
+#include "scroll_list.h"
+#include "hal.h"
+#include "text_renderer.h"
+
+static int viewX = 0;
+static int viewY = 0;
+static int viewWidth = 0;
+static int viewHeight = 0;
+static int rowHeight = 1;
+static uint32_t emptyColor = 0;
+static ScrollRowDrawer drawRow = nullptr;
+
+static uint16_t* viewport = nullptr;    // viewWidth x viewHeight
+static uint16_t* rowBuffer = nullptr;   // viewWidth x rowHeight
+static int rowCount = 0;
+static int offsetPx = 0;                // Content y shown at the top of the viewport
+
+bool scrollListInit(int x, int y, int width, int height, int rowH,
+                    uint32_t empty, ScrollRowDrawer drawer) {
+    viewX = x;
+    viewY = y;
+    viewWidth = width;
+    viewHeight = height;
+    rowHeight = rowH > 0 ? rowH : 1;
+    emptyColor = empty;
+    drawRow = drawer;
+
+    if (viewport == nullptr) {
+        viewport = (uint16_t*)ps_malloc(width * height * sizeof(uint16_t));
+        rowBuffer = (uint16_t*)ps_malloc(width * rowHeight * sizeof(uint16_t));
+    }
+    if (viewport == nullptr || rowBuffer == nullptr) {
+        Serial.println("Failed to allocate scroll list viewport");
+        return false;
+    }
+    return true;
+}
+
+static int maxOffset() {
+    int contentHeight = rowCount * rowHeight;
+    return contentHeight > viewHeight ? contentHeight - viewHeight : 0;
+}
+
+void scrollListSetCount(int count) {
+    rowCount = count > 0 ? count : 0;
+    if (offsetPx > maxOffset()) offsetPx = maxOffset();
+}
+
+int scrollListCount() {
+    return rowCount;
+}
+
+int scrollListFirstRow() {
+    return offsetPx / rowHeight;
+}
+
+// Draw viewport lines [fromLine, toLine) from the rows at the current offset
+static void composeLines(int fromLine, int toLine) {
+    int line = fromLine;
+    while (line < toLine) {
+        int contentY = offsetPx + line;
+        int row = contentY / rowHeight;
+        int rowLine = contentY % rowHeight;
+        int lines = min(rowHeight - rowLine, toLine - line);
+        uint16_t* dst = viewport + line * viewWidth;
+
+        if (row < rowCount) {
+            drawRow(row, rowBuffer, viewWidth, rowHeight);
+            memcpy(dst, rowBuffer + rowLine * viewWidth, lines * viewWidth * sizeof(uint16_t));
+        } else {
+            textFillRect(viewport, viewWidth, viewHeight, 0, line, viewWidth, lines, emptyColor);
+        }
+        line += lines;
+    }
+}
+
+// Position bar: track plus a thumb sized to the visible fraction
+static void drawScrollBar() {
+    int x = viewWidth - SCROLL_BAR_WIDTH;
+    int contentHeight = rowCount * rowHeight;
+    if (contentHeight <= viewHeight) return;
+
+    int thumbHeight = max(viewHeight * viewHeight / contentHeight, 8);
+    int thumbY = (int)((long)(viewHeight - thumbHeight) * offsetPx / maxOffset());
+    textFillRect(viewport, viewWidth, viewHeight, x, 0, SCROLL_BAR_WIDTH, viewHeight, 0xDDDDDD);
+    textFillRect(viewport, viewWidth, viewHeight, x, thumbY, SCROLL_BAR_WIDTH, thumbHeight, 0x888888);
+}
+
+void scrollListRender() {
+    if (viewport == nullptr) return;
+    composeLines(0, viewHeight);
+    drawScrollBar();
+    halDisplayBlit(viewX, viewY, viewWidth, viewHeight, viewport);
+}
+
+bool scrollListScroll(int rows) {
+    if (viewport == nullptr) return false;
+
+    int target = offsetPx + rows * rowHeight;
+    if (target < 0) target = 0;
+    if (target > maxOffset()) target = maxOffset();
+    if (target == offsetPx) return false;
+
+    while (offsetPx != target) {
+        int step = target - offsetPx;
+        if (step > SCROLL_STEP_PX) step = SCROLL_STEP_PX;
+        if (step < -SCROLL_STEP_PX) step = -SCROLL_STEP_PX;
+        offsetPx += step;
+
+        // Move what is already rendered, draw only the lines that came into view
+        if (step > 0) {
+            memmove(viewport, viewport + step * viewWidth,
+                    (viewHeight - step) * viewWidth * sizeof(uint16_t));
+            composeLines(viewHeight - step, viewHeight);
+        } else {
+            memmove(viewport - step * viewWidth, viewport,
+                    (viewHeight + step) * viewWidth * sizeof(uint16_t));
+            composeLines(0, -step);
+        }
+        drawScrollBar();
+
+        halDisplayBlit(viewX, viewY, viewWidth, viewHeight, viewport);
+        halDisplayUpdate();
+    }
+    return true;
+}
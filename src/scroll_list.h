@@ -0,0 +1,42 @@
+/*
+ * Scroll List
+ *
+ * Vertical list of fixed-height rows shown through a viewport on the
+ * canvas. The viewport is an RGB565 buffer of the visible rows; scrolling
+ * shifts the pixels already in it and only draws the rows that come into
+ * view, so a frame costs the same for 5 rows or 500. Rows are drawn by a
+ * callback (typically with text_renderer.h) and pushed with halDisplayBlit().
+ */
+
+#ifndef SCROLL_LIST_H
+#define SCROLL_LIST_H
+
+#include <Arduino.h>
+
+#define SCROLL_STEP_PX 13           // Pixels moved per animation frame
+#define SCROLL_BAR_WIDTH 4          // Position bar at the right edge of the viewport
+
+// Draw one row into buffer (width x height RGB565, row's own coordinates)
+typedef void (*ScrollRowDrawer)(int row, uint16_t* buffer, int width, int height);
+
+// Set up the viewport at (x, y) on the canvas (call once in setup)
+// emptyColor: fill below the last row (0xRRGGBB)
+bool scrollListInit(int x, int y, int width, int height, int rowHeight,
+                    uint32_t emptyColor, ScrollRowDrawer drawRow);
+
+// Set the number of rows (keeps the position if still valid)
+void scrollListSetCount(int count);
+int scrollListCount();
+
+// First row (fully or partly) visible
+int scrollListFirstRow();
+
+// Redraw every visible row and blit the viewport (no screen flush)
+// Call after rows changed or after the canvas was cleared
+void scrollListRender();
+
+// Scroll by rows (negative = up), animated in SCROLL_STEP_PX frames, each
+// blitted and flushed. Returns false if the list is already at that end
+bool scrollListScroll(int rows);
+
+#endif // SCROLL_LIST_H
@@ -0,0 +1,152 @@
+/*
+ * Text Renderer Implementation
+ */
+
+#include "text_renderer.h"
+
+#define CELL_PIXELS (FONT_WIDTH * FONT_HEIGHT)
+
+struct Palette {
+    uint32_t foreground;
+    uint32_t background;
+};
+
+static uint16_t* atlas = nullptr;                       // TEXT_ATLAS_CELLS * CELL_PIXELS
+static int16_t cellOf[TEXT_MAX_PALETTES][FONT_NUM_GLYPHS];   // -1 = not rendered
+static Palette palettes[TEXT_MAX_PALETTES];
+static int numPalettes = 0;
+static TextAtlasStats stats;
+
+static void clearAtlas() {
+    for (int p = 0; p < TEXT_MAX_PALETTES; p++) {
+        for (int g = 0; g < FONT_NUM_GLYPHS; g++) {
+            cellOf[p][g] = -1;
+        }
+    }
+    stats.cellsUsed = 0;
+}
+
+bool textRendererInit() {
+    if (atlas != nullptr) return true;
+
+    atlas = (uint16_t*)ps_malloc(TEXT_ATLAS_CELLS * CELL_PIXELS * sizeof(uint16_t));
+    if (atlas == nullptr) {
+        Serial.println("Failed to allocate glyph atlas");
+        return false;
+    }
+    clearAtlas();
+    return true;
+}
+
+uint16_t textRgb565(uint32_t color) {
+    return ((color >> 8) & 0xF800) | ((color >> 5) & 0x07E0) | ((color >> 3) & 0x001F);
+}
+
+int textPalette(uint32_t foreground, uint32_t background) {
+    for (int i = 0; i < numPalettes; i++) {
+        if (palettes[i].foreground == foreground && palettes[i].background == background) {
+            return i;
+        }
+    }
+    if (numPalettes >= TEXT_MAX_PALETTES) {
+        Serial.println("Text palettes full");
+        return -1;
+    }
+    palettes[numPalettes] = {foreground, background};
+    return numPalettes++;
+}
+
+// Blend one glyph's coverage between the palette colours into a free cell
+static int rasterize(int palette, int glyph) {
+    if (stats.cellsUsed >= TEXT_ATLAS_CELLS) {
+        // Only happens with many palettes in use; start over
+        clearAtlas();
+        stats.atlasResets++;
+    }
+
+    int cell = stats.cellsUsed++;
+    uint16_t* out = atlas + cell * CELL_PIXELS;
+    const uint8_t* coverage = FONT_COVERAGE + glyph * FONT_GLYPH_BYTES;
+    const Palette& pal = palettes[palette];
+
+    // The 16 possible blends, then a lookup per pixel
+    uint16_t shades[16];
+    for (int a = 0; a < 16; a++) {
+        uint32_t color = 0;
+        for (int shift = 0; shift <= 16; shift += 8) {
+            int fg = (pal.foreground >> shift) & 0xFF;
+            int bg = (pal.background >> shift) & 0xFF;
+            color |= (uint32_t)((fg * a + bg * (15 - a) + 7) / 15) << shift;
+        }
+        shades[a] = textRgb565(color);
+    }
+
+    for (int y = 0; y < FONT_HEIGHT; y++) {
+        const uint8_t* row = coverage + y * FONT_ROW_BYTES;
+        for (int x = 0; x < FONT_WIDTH; x++) {
+            uint8_t pair = row[x / 2];
+            *out++ = shades[(x & 1) ? (pair & 0x0F) : (pair >> 4)];
+        }
+    }
+
+    stats.glyphsRasterized++;
+    cellOf[palette][glyph] = cell;
+    return cell;
+}
+
+int textDraw(uint16_t* buffer, int width, int height, int x, int y,
+             const char* text, int palette, int maxChars) {
+    if (atlas == nullptr || palette < 0 || palette >= numPalettes) return x;
+
+    // Rows of the glyph cell that land inside the buffer
+    int rowStart = y < 0 ? -y : 0;
+    int rowEnd = y + FONT_HEIGHT > height ? height - y : FONT_HEIGHT;
+    if (rowStart >= rowEnd) return x;
+
+    for (int n = 0; text[n] != '\0' && n < maxChars; n++, x += FONT_WIDTH) {
+        int c = (uint8_t)text[n];
+        if (c < FONT_FIRST_CHAR || c > FONT_LAST_CHAR) c = '?';
+        int glyph = c - FONT_FIRST_CHAR;
+
+        // Columns of the cell inside the buffer
+        int colStart = x < 0 ? -x : 0;
+        int colEnd = x + FONT_WIDTH > width ? width - x : FONT_WIDTH;
+        if (colStart >= colEnd) continue;
+
+        int cell = cellOf[palette][glyph];
+        if (cell < 0) cell = rasterize(palette, glyph);
+
+        const uint16_t* src = atlas + cell * CELL_PIXELS + rowStart * FONT_WIDTH + colStart;
+        uint16_t* dst = buffer + (y + rowStart) * width + x + colStart;
+        size_t bytes = (colEnd - colStart) * sizeof(uint16_t);
+        for (int row = rowStart; row < rowEnd; row++) {
+            memcpy(dst, src, bytes);
+            src += FONT_WIDTH;
+            dst += width;
+        }
+        stats.glyphsDrawn++;
+    }
+    return x;
+}
+
+void textFillRect(uint16_t* buffer, int width, int height,
+                  int x, int y, int w, int h, uint32_t color) {
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > width) w = width - x;
+    if (y + h > height) h = height - y;
+    if (w <= 0 || h <= 0) return;
+
+    uint16_t pixel = textRgb565(color);
+    uint16_t* row = buffer + y * width + x;
+    for (int i = 0; i < w; i++) {
+        row[i] = pixel;
+    }
+    for (int j = 1; j < h; j++) {
+        memcpy(row + j * width, row, w * sizeof(uint16_t));
+    }
+}
+
+const TextAtlasStats& textAtlasStats() {
+    return stats;
+}
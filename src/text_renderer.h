@@ -0,0 +1,50 @@
+/*
+ * Text Renderer (glyph atlas)
+ *
+ * Draws text into RGB565 buffers by copying pre-rendered glyphs instead of
+ * going through canvasText(). Each glyph of the built-in font
+ * (bitmap_font.h) is rasterized once per foreground/background pair,
+ * already blended and in RGB565, into an atlas in PSRAM. After that,
+ * drawing a character is FONT_HEIGHT row copies.
+ */
+
+#ifndef TEXT_RENDERER_H
+#define TEXT_RENDERER_H
+
+#include <Arduino.h>
+#include "bitmap_font.h"
+
+#define TEXT_ATLAS_CELLS 512        // Glyphs kept rendered (~240 KB in PSRAM)
+#define TEXT_MAX_PALETTES 16        // Foreground/background pairs
+
+// Atlas counters since boot
+struct TextAtlasStats {
+    uint32_t glyphsDrawn;           // Glyph copies into target buffers
+    uint32_t glyphsRasterized;      // Atlas misses
+    uint32_t atlasResets;           // Atlas filled up and was cleared
+    int cellsUsed;                  // Cells in use now
+};
+
+// Allocate the atlas (call once in setup)
+bool textRendererInit();
+
+// Get the palette index for a colour pair (0xRRGGBB), registering it if new
+// Returns -1 when TEXT_MAX_PALETTES pairs are already registered
+int textPalette(uint32_t foreground, uint32_t background);
+
+// Draw text at (x, y) into an RGB565 buffer of width x height pixels
+// Clipped to the buffer and to maxChars characters
+// Returns the x just past the last character drawn
+int textDraw(uint16_t* buffer, int width, int height, int x, int y,
+             const char* text, int palette, int maxChars);
+
+// Fill a rectangle of an RGB565 buffer (clipped)
+void textFillRect(uint16_t* buffer, int width, int height,
+                  int x, int y, int w, int h, uint32_t color);
+
+// 0xRRGGBB to RGB565
+uint16_t textRgb565(uint32_t color);
+
+const TextAtlasStats& textAtlasStats();
+
+#endif // TEXT_RENDERER_H
@@ -7,42 +7,191 @@
 
 #include "vegetable_classifier.h"
 #include "vegetable_model.h"
-
-// Define the class labels (declared extern in header)
-// Order must match labels.txt: 0=Eggplant, 1=Lemon, 2=Cucumber, 3=Tomato, 4=Onion, 5=None
-const char* VEGETABLE_LABELS[NUM_CLASSES] = {
-    "eggplant",
-    "lemon",
-    "cucumber",
-    "tomato",
-    "onion",
-    "none"
-};
+#include <atomic>
 
 // Store last classification probabilities
 float lastProbabilities[NUM_CLASSES] = {0};
-bool modelReady = false;
+// Set by the classifier init task on core 0, read by the UI loop on core 1
+static std::atomic<bool> modelReady(false);
 
 #if !MODEL_IS_PLACEHOLDER
 
 #include <Chirale_TensorFlowLite.h>
-#include <tensorflow/lite/micro/all_ops_resolver.h>
 #include <tensorflow/lite/micro/micro_interpreter.h>
+#include <tensorflow/lite/micro/micro_profiler_interface.h>
 #include <tensorflow/lite/schema/schema_generated.h>
-
-// Tensor arena size - allocate in PSRAM to handle large models
-#define TENSOR_ARENA_SIZE (1300 * 1024)  // 1.3MB
+#include <tensorflow/lite/schema/schema_utils.h>
+#include "model_manager.h"
+
+// Arena sizes for the vegetable model (PSRAM). Persistent holds interpreter
+// state and per-channel quant data, scratch holds activations and is shared
+// with any other resident model.
+// ml/model.tflite (MobileNetV2, 183 tensors, 73 ops) needs about 69KB of
+// persistent arena: 57KB of per-channel output multipliers/shifts for its
+// 7146 conv and depthwise output channels, the rest eval tensors, nodes and
+// op data. The boot log prints the measured high-water mark; keep ~25%
+// headroom over it when the model changes.
+// Scratch: the largest op's live input + output is 1187KB, which is only a
+// lower bound for the planned layout. Keep the pair at the old single arena's
+// 1300KB so activations have no less room than before; the boot log prints
+// the planned size and the headroom left.
+#define VEGETABLE_PERSISTENT_SIZE (88 * 1024)    // 88KB
+#define VEGETABLE_SCRATCH_SIZE (1212 * 1024)     // 1300KB - persistent
 
 // TFLite globals
-static tflite::AllOpsResolver tflOpsResolver;
-static const tflite::Model* tflModel = nullptr;
+static int vegetableModel = -1;
 static tflite::MicroInterpreter* tflInterpreter = nullptr;
 static TfLiteTensor* inputTensor = nullptr;
 static TfLiteTensor* outputTensor = nullptr;
-static uint8_t* tensor_arena = nullptr;
+
+// Embedding = input of the final fully-connected layer
+static int embeddingTensor = -1;     // Tensor index in the model
+static int embeddingFcOrdinal = -1;  // Which FULLY_CONNECTED op (in run order) consumes it
+static int embeddingDim = 0;
+static TfLiteType embeddingType = kTfLiteNoType;
+static float embeddingScale = 1.0f;
+static int embeddingZeroPoint = 0;
+static int8_t lastEmbedding[EMBEDDING_MAX_DIM];
+static bool lastEmbeddingValid = false;
+
+// Dequantized embedding value i from a raw tensor buffer
+static float embeddingValue(const TfLiteEvalTensor* t, int i) {
+    switch (embeddingType) {
+        case kTfLiteInt8:  return (t->data.int8[i] - embeddingZeroPoint) * embeddingScale;
+        case kTfLiteUInt8: return (t->data.uint8[i] - embeddingZeroPoint) * embeddingScale;
+        default:           return t->data.f[i];
+    }
+}
+
+// Copy the embedding into lastEmbedding (L2-normalized, int8 scaled by 127)
+static void captureEmbedding() {
+    const TfLiteEvalTensor* t = tflInterpreter->GetTensor(embeddingTensor);
+    if (t == nullptr) return;
+
+    float sumSq = 0.0f;
+    for (int i = 0; i < embeddingDim; i++) {
+        float v = embeddingValue(t, i);
+        sumSq += v * v;
+    }
+    if (sumSq <= 0.0f) return;
+
+    float k = 127.0f / sqrtf(sumSq);
+    for (int i = 0; i < embeddingDim; i++) {
+        lastEmbedding[i] = (int8_t)lroundf(embeddingValue(t, i) * k);
+    }
+    lastEmbeddingValid = true;
+}
+
+// Grabs the embedding just before the final fully-connected op runs, while
+// its buffer is still live (the planner may reuse it for later tensors)
+class EmbeddingCapture : public tflite::MicroProfilerInterface {
+public:
+    void arm() {
+        armed = embeddingTensor >= 0;
+        fcSeen = 0;
+    }
+
+    uint32_t BeginEvent(const char* tag) override {
+        if (armed && strcmp(tag, "FULLY_CONNECTED") == 0 && fcSeen++ == embeddingFcOrdinal) {
+            captureEmbedding();
+            armed = false;
+        }
+        return 0;
+    }
+
+    void EndEvent(uint32_t eventHandle) override {}
+
+private:
+    bool armed = false;
+    int fcSeen = 0;
+};
+
+static EmbeddingCapture embeddingCapture;
+
+static tflite::BuiltinOperator opCode(const tflite::Model* model, const tflite::Operator* op) {
+    return tflite::GetBuiltinCode(model->operator_codes()->Get(op->opcode_index()));
+}
+
+// Locate the embedding by walking back from the output through
+// softmax/reshape/(de)quantize ops to the last fully-connected layer
+static bool findEmbeddingTensor(const tflite::Model* model) {
+    const tflite::SubGraph* graph = model->subgraphs()->Get(0);
+    const auto* ops = graph->operators();
+    int tensor = graph->outputs()->Get(0);
+
+    for (int step = 0; step < 8; step++) {
+        int producer = -1;
+        for (int i = (int)ops->size() - 1; i >= 0 && producer < 0; i--) {
+            const auto* outputs = ops->Get(i)->outputs();
+            for (unsigned o = 0; o < outputs->size(); o++) {
+                if (outputs->Get(o) == tensor) producer = i;
+            }
+        }
+        if (producer < 0) return false;
+
+        const tflite::Operator* op = ops->Get(producer);
+        tflite::BuiltinOperator code = opCode(model, op);
+
+        if (code == tflite::BuiltinOperator_FULLY_CONNECTED) {
+            embeddingTensor = op->inputs()->Get(0);
+            embeddingFcOrdinal = 0;
+            for (int i = 0; i < producer; i++) {
+                if (opCode(model, ops->Get(i)) == tflite::BuiltinOperator_FULLY_CONNECTED) {
+                    embeddingFcOrdinal++;
+                }
+            }
+
+            // Size and quantization from the schema
+            const tflite::Tensor* t = graph->tensors()->Get(embeddingTensor);
+            embeddingDim = 1;
+            for (unsigned d = 1; d < t->shape()->size(); d++) {
+                embeddingDim *= t->shape()->Get(d);
+            }
+
+            switch (t->type()) {
+                case tflite::TensorType_INT8:    embeddingType = kTfLiteInt8; break;
+                case tflite::TensorType_UINT8:   embeddingType = kTfLiteUInt8; break;
+                case tflite::TensorType_FLOAT32: embeddingType = kTfLiteFloat32; break;
+                default: embeddingTensor = -1; return false;
+            }
+
+            const tflite::QuantizationParameters* q = t->quantization();
+            if (q != nullptr && q->scale() != nullptr && q->scale()->size() > 0) {
+                embeddingScale = q->scale()->Get(0);
+                embeddingZeroPoint = q->zero_point() != nullptr ? (int)q->zero_point()->Get(0) : 0;
+            }
+
+            if (embeddingDim > EMBEDDING_MAX_DIM) {
+                Serial.printf("Embedding too large: %d\n", embeddingDim);
+                embeddingTensor = -1;
+                embeddingDim = 0;
+                return false;
+            }
+            return true;
+        }
+
+        if (code != tflite::BuiltinOperator_SOFTMAX && code != tflite::BuiltinOperator_RESHAPE &&
+            code != tflite::BuiltinOperator_QUANTIZE && code != tflite::BuiltinOperator_DEQUANTIZE) {
+            return false;
+        }
+        tensor = op->inputs()->Get(0);
+    }
+    return false;
+}
 
 #endif // !MODEL_IS_PLACEHOLDER
 
+bool classifierRegister() {
+    #if MODEL_IS_PLACEHOLDER
+    return true;
+    #else
+    vegetableModel = modelManagerRegister("vegetable", vegetable_model_tflite,
+                                          VEGETABLE_PERSISTENT_SIZE, VEGETABLE_SCRATCH_SIZE,
+                                          &embeddingCapture);
+    return vegetableModel >= 0;
+    #endif
+}
+
 bool classifierInit() {
     Serial.println("Initializing vegetable classifier...");
 
@@ -52,26 +201,8 @@ bool classifierInit() {
     return true;
     #else
 
-    // Allocate tensor arena in PSRAM
-    tensor_arena = (uint8_t*)ps_malloc(TENSOR_ARENA_SIZE);
-    if (tensor_arena == nullptr) {
-        Serial.println("Failed to allocate tensor arena in PSRAM!");
-        return false;
-    }
-    Serial.printf("Allocated %d KB tensor arena in PSRAM\n", TENSOR_ARENA_SIZE / 1024);
-
-    // Load the model
-    tflModel = tflite::GetModel(vegetable_model_tflite);
-    if (tflModel->version() != TFLITE_SCHEMA_VERSION) {
-        Serial.printf("Model schema mismatch: %d vs %d\n", tflModel->version(), TFLITE_SCHEMA_VERSION);
-        return false;
-    }
-
-    // Create interpreter
-    tflInterpreter = new tflite::MicroInterpreter(tflModel, tflOpsResolver, tensor_arena, TENSOR_ARENA_SIZE);
-
-    // Allocate tensors
-    if (tflInterpreter->AllocateTensors() != kTfLiteOk) {
+    tflInterpreter = modelManagerSelect(vegetableModel);
+    if (tflInterpreter == nullptr) {
         Serial.println("Failed to allocate tensors!");
         return false;
     }
@@ -80,6 +211,13 @@ bool classifierInit() {
     inputTensor = tflInterpreter->input(0);
     outputTensor = tflInterpreter->output(0);
 
+    if (findEmbeddingTensor(tflite::GetModel(vegetable_model_tflite))) {
+        Serial.printf("Embedding: tensor %d, dim=%d, type=%d (FC #%d input)\n",
+                      embeddingTensor, embeddingDim, embeddingType, embeddingFcOrdinal);
+    } else {
+        Serial.println("No embedding layer found, enrolled items disabled");
+    }
+
     // Print tensor info for debugging
     Serial.printf("Input tensor: type=%d, dims=[%d,%d,%d,%d], bytes=%d\n",
                   inputTensor->type,
@@ -107,122 +245,153 @@ bool classifierInit() {
     #endif
 }
 
-ClassificationResult classifyImage(uint8_t* imageData, int width, int height) {
-    ClassificationResult result = {-1, "unknown", 0.0f, false};
+#if !MODEL_IS_PLACEHOLDER
 
-    #if MODEL_IS_PLACEHOLDER
-    Serial.println("Cannot classify: placeholder model loaded");
-    return result;
-    #else
+// Source x offset (in bytes) for each model input column, rebuilt per region
+static int srcColOffset[MODEL_INPUT_WIDTH];
 
-    if (!modelReady) {
-        Serial.println("Classifier not initialized!");
-        return result;
-    }
+// Resample one image region into one batch slot of the input tensor
+static void fillInputSlot(int slot, const uint8_t* imageData, int width, const ImageRegion& region) {
+    float xRatio = (float)region.width / MODEL_INPUT_WIDTH;
+    float yRatio = (float)region.height / MODEL_INPUT_HEIGHT;
 
-    // Prepare input - resize image to model input size
-    float xRatio = (float)width / MODEL_INPUT_WIDTH;
-    float yRatio = (float)height / MODEL_INPUT_HEIGHT;
+    for (int x = 0; x < MODEL_INPUT_WIDTH; x++) {
+        srcColOffset[x] = (region.x + (int)(x * xRatio)) * 3;
+    }
 
-    unsigned long startTime = millis();
+    int idx = slot * MODEL_INPUT_WIDTH * MODEL_INPUT_HEIGHT * MODEL_INPUT_CHANNELS;
 
     // Fill input tensor based on its type
     if (inputTensor->type == kTfLiteUInt8) {
         // Quantized uint8 input (0-255 maps to 0-255, typically)
         uint8_t* inputData = inputTensor->data.uint8;
-        int idx = 0;
         for (int y = 0; y < MODEL_INPUT_HEIGHT; y++) {
+            const uint8_t* srcRow = imageData + (region.y + (int)(y * yRatio)) * width * 3;
             for (int x = 0; x < MODEL_INPUT_WIDTH; x++) {
-                int srcX = (int)(x * xRatio);
-                int srcY = (int)(y * yRatio);
-                int srcIdx = (srcY * width + srcX) * 3;
-                inputData[idx++] = imageData[srcIdx];       // R
-                inputData[idx++] = imageData[srcIdx + 1];   // G
-                inputData[idx++] = imageData[srcIdx + 2];   // B
+                const uint8_t* src = srcRow + srcColOffset[x];
+                inputData[idx++] = src[0];   // R
+                inputData[idx++] = src[1];   // G
+                inputData[idx++] = src[2];   // B
             }
         }
     } else if (inputTensor->type == kTfLiteInt8) {
         // Quantized int8 input (0-255 maps to -128 to 127)
         int8_t* inputData = inputTensor->data.int8;
-        int idx = 0;
         for (int y = 0; y < MODEL_INPUT_HEIGHT; y++) {
+            const uint8_t* srcRow = imageData + (region.y + (int)(y * yRatio)) * width * 3;
             for (int x = 0; x < MODEL_INPUT_WIDTH; x++) {
-                int srcX = (int)(x * xRatio);
-                int srcY = (int)(y * yRatio);
-                int srcIdx = (srcY * width + srcX) * 3;
-                inputData[idx++] = (int8_t)(imageData[srcIdx] - 128);       // R
-                inputData[idx++] = (int8_t)(imageData[srcIdx + 1] - 128);   // G
-                inputData[idx++] = (int8_t)(imageData[srcIdx + 2] - 128);   // B
+                const uint8_t* src = srcRow + srcColOffset[x];
+                inputData[idx++] = (int8_t)(src[0] - 128);   // R
+                inputData[idx++] = (int8_t)(src[1] - 128);   // G
+                inputData[idx++] = (int8_t)(src[2] - 128);   // B
             }
         }
     } else if (inputTensor->type == kTfLiteFloat32) {
         // Float input (normalize to 0-1)
         float* inputData = inputTensor->data.f;
-        int idx = 0;
         for (int y = 0; y < MODEL_INPUT_HEIGHT; y++) {
+            const uint8_t* srcRow = imageData + (region.y + (int)(y * yRatio)) * width * 3;
             for (int x = 0; x < MODEL_INPUT_WIDTH; x++) {
-                int srcX = (int)(x * xRatio);
-                int srcY = (int)(y * yRatio);
-                int srcIdx = (srcY * width + srcX) * 3;
-                inputData[idx++] = imageData[srcIdx] / 255.0f;       // R
-                inputData[idx++] = imageData[srcIdx + 1] / 255.0f;   // G
-                inputData[idx++] = imageData[srcIdx + 2] / 255.0f;   // B
+                const uint8_t* src = srcRow + srcColOffset[x];
+                inputData[idx++] = src[0] / 255.0f;   // R
+                inputData[idx++] = src[1] / 255.0f;   // G
+                inputData[idx++] = src[2] / 255.0f;   // B
             }
         }
     }
+}
 
-    // Run inference
-    if (tflInterpreter->Invoke() != kTfLiteOk) {
-        Serial.println("Inference failed!");
-        return result;
-    }
-
-    unsigned long inferenceTime = millis() - startTime;
-    Serial.printf("Inference time: %lu ms\n", inferenceTime);
-
-    // Read outputs based on tensor type
-    float output[NUM_CLASSES];
+// Read class probabilities for one batch slot of the output tensor
+static void readOutputSlot(int slot, float* output) {
     int numOutputs = outputTensor->dims->data[1];  // Second dimension is num classes
+    int base = slot * numOutputs;
+
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        output[i] = 0.0f;
+    }
 
     if (outputTensor->type == kTfLiteUInt8) {
-        uint8_t* outputData = outputTensor->data.uint8;
+        uint8_t* outputData = outputTensor->data.uint8 + base;
         float scale = outputTensor->params.scale;
         int zeroPoint = outputTensor->params.zero_point;
         for (int i = 0; i < numOutputs && i < NUM_CLASSES; i++) {
             output[i] = (outputData[i] - zeroPoint) * scale;
         }
     } else if (outputTensor->type == kTfLiteInt8) {
-        int8_t* outputData = outputTensor->data.int8;
+        int8_t* outputData = outputTensor->data.int8 + base;
         float scale = outputTensor->params.scale;
         int zeroPoint = outputTensor->params.zero_point;
         for (int i = 0; i < numOutputs && i < NUM_CLASSES; i++) {
             output[i] = (outputData[i] - zeroPoint) * scale;
         }
     } else if (outputTensor->type == kTfLiteFloat32) {
-        float* outputData = outputTensor->data.f;
+        float* outputData = outputTensor->data.f + base;
         for (int i = 0; i < numOutputs && i < NUM_CLASSES; i++) {
             output[i] = outputData[i];
         }
     }
+}
 
-    // Find max probability
+// Pick the most probable class
+static ClassificationResult topClass(const float* output) {
     int maxIdx = 0;
     float maxProb = -999.0f;
 
     for (int i = 0; i < NUM_CLASSES; i++) {
-        lastProbabilities[i] = output[i];
-        Serial.printf("  %s: %.1f%%\n", VEGETABLE_LABELS[i], output[i] * 100);
-
         if (output[i] > maxProb) {
             maxProb = output[i];
             maxIdx = i;
         }
     }
 
-    result.classIndex = maxIdx;
-    result.className = VEGETABLE_LABELS[maxIdx];
-    result.confidence = maxProb;
-    result.valid = true;
+    ClassificationResult result = {maxIdx, VEGETABLE_LABELS[maxIdx], maxProb, true};
+    return result;
+}
+
+#endif // !MODEL_IS_PLACEHOLDER
+
+ClassificationResult classifyImage(uint8_t* imageData, int width, int height) {
+    ClassificationResult result = {-1, "unknown", 0.0f, false};
+
+    #if MODEL_IS_PLACEHOLDER
+    Serial.println("Cannot classify: placeholder model loaded");
+    return result;
+    #else
+
+    if (!modelReady) {
+        Serial.println("Classifier not initialized!");
+        return result;
+    }
+
+    // Another resident model may have run since, so inputs are refilled below
+    modelManagerSelect(vegetableModel);
+
+    unsigned long startTime = millis();
+
+    // Prepare input - resize whole image to model input size
+    ImageRegion fullFrame = {0, 0, width, height};
+    fillInputSlot(0, imageData, width, fullFrame);
+
+    // Run inference (capturing the embedding on the way)
+    clearLastEmbedding();
+    embeddingCapture.arm();
+    if (tflInterpreter->Invoke() != kTfLiteOk) {
+        Serial.println("Inference failed!");
+        return result;
+    }
+
+    unsigned long inferenceTime = millis() - startTime;
+    Serial.printf("Inference time: %lu ms\n", inferenceTime);
+
+    float output[NUM_CLASSES];
+    readOutputSlot(0, output);
+
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        lastProbabilities[i] = output[i];
+        Serial.printf("  %s: %.1f%%\n", VEGETABLE_LABELS[i], output[i] * 100);
+    }
+
+    result = topClass(output);
 
     Serial.printf("Result: %s (%.1f%%)\n", result.className, result.confidence * 100);
 
@@ -230,12 +399,119 @@ ClassificationResult classifyImage(uint8_t* imageData, int width, int height) {
     #endif
 }
 
+bool classifyRegions(uint8_t* imageData, int width, int height,
+                     const ImageRegion* regions, int numRegions,
+                     float minConfidence, MultiScanResult& out) {
+    out.numRegions = 0;
+    out.totalItems = 0;
+    out.valid = false;
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        out.itemCounts[i] = 0;
+    }
+
+    clearLastEmbedding();
+
+    #if MODEL_IS_PLACEHOLDER
+    Serial.println("Cannot classify: placeholder model loaded");
+    return false;
+    #else
+
+    if (!modelReady) {
+        Serial.println("Classifier not initialized!");
+        return false;
+    }
+
+    modelManagerSelect(vegetableModel);
+
+    if (numRegions > MAX_SCAN_REGIONS) numRegions = MAX_SCAN_REGIONS;
+
+    // Clip regions to the image so resampling never reads out of bounds
+    for (int i = 0; i < numRegions; i++) {
+        ImageRegion r = regions[i];
+        if (r.x < 0) { r.width += r.x; r.x = 0; }
+        if (r.y < 0) { r.height += r.y; r.y = 0; }
+        if (r.x + r.width > width) r.width = width - r.x;
+        if (r.y + r.height > height) r.height = height - r.y;
+        if (r.width < 1 || r.height < 1) {
+            Serial.printf("Region %d is outside the image\n", i);
+            return false;
+        }
+        out.regions[i] = r;
+        out.results[i] = {-1, "unknown", 0.0f, false};
+    }
+    out.numRegions = numRegions;
+
+    // Batch size is fixed when the model is converted (TFLM cannot resize inputs)
+    int batchSize = inputTensor->dims->data[0];
+    if (batchSize < 1) batchSize = 1;
+    if (outputTensor->dims->data[0] < batchSize) batchSize = outputTensor->dims->data[0];
+
+    unsigned long startTime = millis();
+    int invokes = 0;
+
+    for (int start = 0; start < numRegions; start += batchSize) {
+        int count = min(batchSize, numRegions - start);
+
+        for (int slot = 0; slot < count; slot++) {
+            fillInputSlot(slot, imageData, width, out.regions[start + slot]);
+        }
+
+        if (tflInterpreter->Invoke() != kTfLiteOk) {
+            Serial.println("Inference failed!");
+            return false;
+        }
+        invokes++;
+
+        for (int slot = 0; slot < count; slot++) {
+            float output[NUM_CLASSES];
+            readOutputSlot(slot, output);
+            ClassificationResult& res = out.results[start + slot];
+            res = topClass(output);
+            Serial.printf("  region %d: %s (%.1f%%)\n",
+                          start + slot, res.className, res.confidence * 100);
+        }
+    }
+
+    countScanItems(out, minConfidence);
+    out.valid = true;
+
+    Serial.printf("Multi-scan: %d regions, %d invokes (batch %d), %lu ms, %d items\n",
+                  numRegions, invokes, batchSize, millis() - startTime, out.totalItems);
+
+    return true;
+    #endif
+}
+
 void getClassProbabilities(float* probabilities) {
     for (int i = 0; i < NUM_CLASSES; i++) {
         probabilities[i] = lastProbabilities[i];
     }
 }
 
+void clearLastEmbedding() {
+    #if !MODEL_IS_PLACEHOLDER
+    lastEmbeddingValid = false;
+    #endif
+}
+
+int getLastEmbedding(int8_t* embedding) {
+    #if MODEL_IS_PLACEHOLDER
+    return 0;
+    #else
+    if (!lastEmbeddingValid) return 0;
+    memcpy(embedding, lastEmbedding, embeddingDim);
+    return embeddingDim;
+    #endif
+}
+
+int getEmbeddingDim() {
+    #if MODEL_IS_PLACEHOLDER
+    return 0;
+    #else
+    return embeddingTensor >= 0 ? embeddingDim : 0;
+    #endif
+}
+
 bool isModelReady() {
     return modelReady;
 }
@@ -18,7 +18,38 @@ struct ClassificationResult {
     bool valid;              // Whether classification was successful
 };
 
-// Initialize the classifier (call once in setup)
+// Class index reported for a match against a user-enrolled example
+#define ENROLLED_CLASS_INDEX NUM_CLASSES
+
+// Largest supported embedding (penultimate layer) size
+#define EMBEDDING_MAX_DIM 1280
+
+// Maximum number of regions classified in one multi-item scan
+#define MAX_SCAN_REGIONS 9
+
+// Rectangle within the source image (pixels)
+struct ImageRegion {
+    int x;
+    int y;
+    int width;
+    int height;
+};
+
+// Multi-item scan result
+struct MultiScanResult {
+    int numRegions;                                  // Number of regions classified
+    ImageRegion regions[MAX_SCAN_REGIONS];           // Region rectangles
+    ClassificationResult results[MAX_SCAN_REGIONS];  // Per-region prediction
+    int itemCounts[NUM_CLASSES];                     // Deduplicated item count per class
+    int totalItems;                                  // Sum of itemCounts
+    bool valid;                                      // Whether all regions were classified
+};
+
+// Register the classifier's model with the model manager
+// Call once in setup, before modelManagerBegin()
+bool classifierRegister();
+
+// Initialize the classifier (call once, after modelManagerBegin())
 bool classifierInit();
 
 // Classify an image
@@ -27,10 +58,46 @@ bool classifierInit();
 // Returns classification result
 ClassificationResult classifyImage(uint8_t* imageData, int width, int height);
 
+// Split an image into a cols x rows grid of proposal regions that overlap
+// their neighbours by half: each region is 2 / (cols + 1) of the width and
+// 2 / (rows + 1) of the height, so an item on a tile edge is still seen
+// whole by the region centred on it
+// regions: array of at least cols * rows entries (capped at MAX_SCAN_REGIONS)
+// Returns number of regions written
+int makeGridRegions(int width, int height, int cols, int rows, ImageRegion* regions);
+
+// Fill out.itemCounts / out.totalItems from out.results
+// Overlapping regions with the same class are one item (transitively, so
+// touching items of one class may merge); regions that only share an edge
+// or corner are separate
+void countScanItems(MultiScanResult& out, float minConfidence);
+
+// Classify several regions of one image (multi-item scan)
+// Regions are resampled in one pass and run through the model as a batch
+// when its input tensor has a batch dimension > 1, otherwise one by one.
+// Overlapping regions with the same class are counted as one item;
+// "none" and predictions below minConfidence are not counted.
+bool classifyRegions(uint8_t* imageData, int width, int height,
+                     const ImageRegion* regions, int numRegions,
+                     float minConfidence, MultiScanResult& out);
+
 // Get all class probabilities from last classification
 // probabilities: array of NUM_CLASSES floats to fill
 void getClassProbabilities(float* probabilities);
 
+// Get the penultimate-layer embedding of the last classifyImage() call
+// embedding: array of at least getEmbeddingDim() values, L2-normalized and
+// scaled to int8 (127 = 1.0) so a dot product gives cosine similarity
+// Returns embedding length, or 0 if no embedding is available
+int getLastEmbedding(int8_t* embedding);
+
+// Forget the last embedding, so a scan that does not produce one (rejected
+// frame, multi-item scan) cannot leave an older one behind for enrolment
+void clearLastEmbedding();
+
+// Embedding length of the loaded model (0 if the model has none)
+int getEmbeddingDim();
+
 // Check if model is loaded and ready
 bool isModelReady();
 
@@ -0,0 +1,18 @@
+/*
+ * Vegetable class labels
+ *
+ * Kept apart from the TFLite classifier so the simulator can share them.
+ */
+
+#include "vegetable_model.h"
+
+// Define the class labels (declared extern in header)
+// Order must match labels.txt: 0=Eggplant, 1=Lemon, 2=Cucumber, 3=Tomato, 4=Onion, 5=None
+const char* VEGETABLE_LABELS[NUM_CLASSES] = {
+    "eggplant",
+    "lemon",
+    "cucumber",
+    "tomato",
+    "onion",
+    "none"
+};
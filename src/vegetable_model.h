@@ -19,6 +19,9 @@
 // 0 Eggplant, 1 Lemon, 2 Cucumber, 3 Tomato, 4 Onion, 5 None
 extern const char* VEGETABLE_LABELS[NUM_CLASSES];
 
+// Index of the "none" (no vegetable) class
+#define NONE_CLASS_INDEX 5
+
 // Model input dimensions (Teachable Machine default is 224x224)
 #define MODEL_INPUT_WIDTH 224
 #define MODEL_INPUT_HEIGHT 224
@@ -0,0 +1,138 @@
+/*
+ * Frame quality check (frame_quality.cpp)
+ */
+
+#include <unity.h>
+#include <string.h>
+#include "frame_quality.h"
+
+#define WIDTH 320
+#define HEIGHT 240
+#define BIG_SIZE 1024
+
+static uint8_t frame[WIDTH * HEIGHT * 2];
+static uint8_t bigFrame[BIG_SIZE * BIG_SIZE * 2];
+static FrameQuality quality;
+
+static void setPixel(uint8_t* buffer, int width, int x, int y, int r, int g, int b) {
+    uint16_t pixel = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+    buffer[(y * width + x) * 2] = pixel & 0xFF;
+    buffer[(y * width + x) * 2 + 1] = pixel >> 8;
+}
+
+static void fill(uint8_t* buffer, int width, int height, int r, int g, int b) {
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) setPixel(buffer, width, x, y, r, g, b);
+    }
+}
+
+// Grey background with hard-edged red 16x16 squares on a 32 px grid
+static void fillProduceScene() {
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+            if ((x & 31) < 16 && (y & 31) < 16) setPixel(frame, WIDTH, x, y, 220, 40, 30);
+            else setPixel(frame, WIDTH, x, y, 128, 128, 128);
+        }
+    }
+}
+
+void setUp(void) {
+    memset(&quality, 0, sizeof(quality));
+}
+
+void tearDown(void) {
+}
+
+void test_black_frame_is_too_dark(void) {
+    fill(frame, WIDTH, HEIGHT, 0, 0, 0);
+    TEST_ASSERT_EQUAL_INT(FRAME_TOO_DARK, checkFrameQuality(frame, WIDTH, HEIGHT, quality));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.0f, quality.darkFraction);
+}
+
+void test_white_frame_is_too_bright(void) {
+    fill(frame, WIDTH, HEIGHT, 255, 255, 255);
+    TEST_ASSERT_EQUAL_INT(FRAME_TOO_BRIGHT, checkFrameQuality(frame, WIDTH, HEIGHT, quality));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.0f, quality.brightFraction);
+}
+
+void test_flat_frame_is_blurry(void) {
+    fill(frame, WIDTH, HEIGHT, 128, 128, 128);
+    TEST_ASSERT_EQUAL_INT(FRAME_BLURRY, checkFrameQuality(frame, WIDTH, HEIGHT, quality));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, quality.sharpness);
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 128.0f, quality.meanLuma);
+}
+
+void test_smooth_ramp_is_blurry(void) {
+    // A linear ramp has no second derivative, however colourful it is
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) setPixel(frame, WIDTH, x, y, 80 + x / 2, 40, 30);
+    }
+    TEST_ASSERT_EQUAL_INT(FRAME_BLURRY, checkFrameQuality(frame, WIDTH, HEIGHT, quality));
+}
+
+void test_grey_edges_without_produce_are_empty(void) {
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+            int v = ((x & 31) < 16) != ((y & 31) < 16) ? 80 : 170;
+            setPixel(frame, WIDTH, x, y, v, v, v);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(FRAME_EMPTY, checkFrameQuality(frame, WIDTH, HEIGHT, quality));
+    TEST_ASSERT_TRUE(quality.sharpness >= FQ_MIN_SHARPNESS);
+}
+
+void test_sharp_produce_is_ok(void) {
+    fillProduceScene();
+    TEST_ASSERT_EQUAL_INT(FRAME_OK, checkFrameQuality(frame, WIDTH, HEIGHT, quality));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.5f * (8 * 16) / HEIGHT, quality.coverage);  // 10 x 8 squares
+    TEST_ASSERT_EQUAL_INT(FRAME_OK, lastFrameQuality().verdict);
+}
+
+void test_samples_are_block_averages(void) {
+    // 1 px checkerboard of two greys: every 4x4 block averages to the same value
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+            int v = ((x + y) & 1) ? 96 : 160;
+            setPixel(frame, WIDTH, x, y, v, v, v);
+        }
+    }
+    checkFrameQuality(frame, WIDTH, HEIGHT, quality);
+    TEST_ASSERT_EQUAL_INT((WIDTH / FQ_SAMPLE_STEP) * (HEIGHT / FQ_SAMPLE_STEP), quality.samples);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, quality.sharpness);
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 128.0f, quality.meanLuma);
+}
+
+void test_partial_edge_blocks(void) {
+    // 318x238: the last block column and row are 2 px, averaged over their real size
+    fill(frame, 318, 238, 128, 128, 128);
+    checkFrameQuality(frame, 318, 238, quality);
+    TEST_ASSERT_EQUAL_INT(80 * 60, quality.samples);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, quality.sharpness);
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 128.0f, quality.meanLuma);
+}
+
+void test_histogram_holds_large_frames(void) {
+    // 256 x 256 samples all land in one bin, more than a uint16_t can count
+    fill(bigFrame, BIG_SIZE, BIG_SIZE, 128, 128, 128);
+    checkFrameQuality(bigFrame, BIG_SIZE, BIG_SIZE, quality);
+    TEST_ASSERT_EQUAL_INT(65536, quality.samples);
+    TEST_ASSERT_EQUAL_UINT32(65536, quality.histogram[128 * FQ_HIST_BINS / 256]);
+
+    uint32_t total = 0;
+    for (int i = 0; i < FQ_HIST_BINS; i++) total += quality.histogram[i];
+    TEST_ASSERT_EQUAL_UINT32(65536, total);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_black_frame_is_too_dark);
+    RUN_TEST(test_white_frame_is_too_bright);
+    RUN_TEST(test_flat_frame_is_blurry);
+    RUN_TEST(test_smooth_ramp_is_blurry);
+    RUN_TEST(test_grey_edges_without_produce_are_empty);
+    RUN_TEST(test_sharp_produce_is_ok);
+    RUN_TEST(test_samples_are_block_averages);
+    RUN_TEST(test_partial_edge_blocks);
+    RUN_TEST(test_histogram_holds_large_frames);
+    return UNITY_END();
+}
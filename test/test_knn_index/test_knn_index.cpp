@@ -0,0 +1,180 @@
+/*
+ * kNN index: top-K search, weighted vote and the index file (knn_index.cpp)
+ */
+
+#include <unity.h>
+#include <SPIFFS.h>
+#include "knn_index.h"
+
+#define DIM 40  // Not a multiple of 16, so rows are padded
+#define TEST_ROOT "/tmp/test_knn_index"
+
+static int8_t query[DIM];
+
+// Unit vector at the given cosine similarity to the query (which is axis 0),
+// leaning towards another axis so different examples are distinct
+static void example(int8_t* v, float similarity, int axis) {
+    memset(v, 0, DIM);
+    v[0] = (int8_t)lroundf(127.0f * similarity);
+    v[axis] = (int8_t)lroundf(127.0f * sqrtf(1.0f - similarity * similarity));
+}
+
+static void enroll(const char* label, float similarity, int axis) {
+    int8_t v[DIM];
+    example(v, similarity, axis);
+    TEST_ASSERT_TRUE(knnEnroll(label, v));
+}
+
+static size_t indexFileSize() {
+    File f = SPIFFS.open(KNN_INDEX_PATH, FILE_READ);
+    size_t size = f ? f.size() : 0;
+    f.close();
+    return size;
+}
+
+void setUp(void) {
+    simSerialEnable(false);
+    SPIFFS.setRoot(TEST_ROOT);
+    SPIFFS.begin(true);
+    SPIFFS.remove(KNN_INDEX_PATH);
+    TEST_ASSERT_TRUE(knnInit(DIM));
+
+    memset(query, 0, sizeof(query));
+    query[0] = 127;
+}
+
+void tearDown(void) {
+    SPIFFS.remove(KNN_INDEX_PATH);
+}
+
+void test_empty_index_has_no_match(void) {
+    KnnMatch match = knnLookup(query);
+    TEST_ASSERT_FALSE(match.valid);
+    TEST_ASSERT_NULL(match.label);
+}
+
+void test_top_k_keeps_best_in_any_order(void) {
+    // Worst first: every new example has to bubble to the front
+    enroll("far", 0.1f, 1);
+    enroll("far", 0.2f, 2);
+    enroll("far", 0.3f, 3);
+    enroll("near", 0.85f, 4);
+    enroll("near", 0.88f, 5);
+    enroll("near", 0.9f, 6);
+
+    KnnMatch match = knnLookup(query);
+    TEST_ASSERT_TRUE(match.valid);
+    TEST_ASSERT_EQUAL_STRING("near", match.label);
+    TEST_ASSERT_EQUAL_INT(KNN_K, match.votes);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.9f, match.similarity);
+
+    // Best first: later examples must not push it out
+    knnClear();
+    enroll("near", 0.9f, 6);
+    enroll("near", 0.88f, 5);
+    enroll("near", 0.85f, 4);
+    enroll("far", 0.3f, 3);
+    enroll("far", 0.2f, 2);
+
+    match = knnLookup(query);
+    TEST_ASSERT_EQUAL_STRING("near", match.label);
+    TEST_ASSERT_EQUAL_INT(KNN_K, match.votes);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.9f, match.similarity);
+}
+
+void test_vote_is_weighted_by_similarity(void) {
+    // Two fairly close examples outweigh one very close one
+    enroll("apple", 0.99f, 1);
+    enroll("pear", 0.85f, 2);
+    enroll("pear", 0.85f, 3);
+
+    KnnMatch match = knnLookup(query);
+    TEST_ASSERT_EQUAL_STRING("pear", match.label);
+    TEST_ASSERT_EQUAL_INT(2, match.votes);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.85f, match.similarity);
+    TEST_ASSERT_TRUE(match.valid);
+
+    // Two distant examples do not outvote one close one
+    knnClear();
+    enroll("apple", 0.99f, 1);
+    enroll("pear", 0.3f, 2);
+    enroll("pear", 0.3f, 3);
+
+    match = knnLookup(query);
+    TEST_ASSERT_EQUAL_STRING("apple", match.label);
+    TEST_ASSERT_EQUAL_INT(1, match.votes);
+    TEST_ASSERT_TRUE(match.valid);
+}
+
+void test_dissimilar_match_is_not_valid(void) {
+    enroll("apple", 0.5f, 1);
+    KnnMatch match = knnLookup(query);
+    TEST_ASSERT_EQUAL_STRING("apple", match.label);
+    TEST_ASSERT_FALSE(match.valid);
+}
+
+void test_reload_from_file(void) {
+    enroll("apple", 0.95f, 1);
+    enroll("pear", 0.2f, 2);
+    enroll("apple", 0.9f, 3);
+
+    TEST_ASSERT_TRUE(knnInit(DIM));
+    TEST_ASSERT_EQUAL_INT(3, knnCount());
+
+    KnnMatch match = knnLookup(query);
+    TEST_ASSERT_EQUAL_STRING("apple", match.label);
+    TEST_ASSERT_EQUAL_INT(2, match.votes);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.95f, match.similarity);
+}
+
+void test_partial_record_is_dropped_on_load(void) {
+    enroll("apple", 0.95f, 1);
+    enroll("pear", 0.9f, 2);
+    size_t whole = indexFileSize();
+
+    // Half a record, as left by a failed write
+    File f = SPIFFS.open(KNN_INDEX_PATH, FILE_APPEND);
+    const uint8_t junk[KNN_LABEL_LEN / 2] = {'x'};
+    f.write(junk, sizeof(junk));
+    f.close();
+
+    TEST_ASSERT_TRUE(knnInit(DIM));
+    TEST_ASSERT_EQUAL_INT(2, knnCount());
+    TEST_ASSERT_EQUAL_INT((int)whole, (int)indexFileSize());
+
+    // Appends line up with the records again
+    enroll("plum", 0.99f, 3);
+    TEST_ASSERT_TRUE(knnInit(DIM));
+    TEST_ASSERT_EQUAL_INT(3, knnCount());
+    TEST_ASSERT_EQUAL_STRING("plum", knnLookup(query).label);
+}
+
+void test_other_dimension_is_discarded(void) {
+    enroll("apple", 0.95f, 1);
+    TEST_ASSERT_TRUE(knnInit(DIM - 8));
+    TEST_ASSERT_EQUAL_INT(0, knnCount());
+    TEST_ASSERT_FALSE(SPIFFS.exists(KNN_INDEX_PATH));
+}
+
+void test_clear_removes_file(void) {
+    enroll("apple", 0.95f, 1);
+    knnClear();
+    TEST_ASSERT_EQUAL_INT(0, knnCount());
+    TEST_ASSERT_FALSE(SPIFFS.exists(KNN_INDEX_PATH));
+
+    TEST_ASSERT_TRUE(knnInit(DIM));
+    TEST_ASSERT_EQUAL_INT(0, knnCount());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_empty_index_has_no_match);
+    RUN_TEST(test_top_k_keeps_best_in_any_order);
+    RUN_TEST(test_vote_is_weighted_by_similarity);
+    RUN_TEST(test_dissimilar_match_is_not_valid);
+    RUN_TEST(test_reload_from_file);
+    RUN_TEST(test_partial_record_is_dropped_on_load);
+    RUN_TEST(test_other_dimension_is_discarded);
+    RUN_TEST(test_clear_removes_file);
+    return UNITY_END();
+}
@@ -0,0 +1,153 @@
+/*
+ * Multi-item scan: grid layout and item counting (scan_regions.cpp)
+ */
+
+#include <unity.h>
+#include "vegetable_classifier.h"
+
+#define TOMATO 3
+#define LEMON 1
+
+static MultiScanResult scan;
+
+// 3x3 grid of half-overlapping regions over a 320x240 frame, every tile
+// "none" to start with
+void setUp(void) {
+    memset(&scan, 0, sizeof(scan));
+    scan.numRegions = makeGridRegions(320, 240, 3, 3, scan.regions);
+    for (int i = 0; i < scan.numRegions; i++) {
+        scan.results[i] = {NONE_CLASS_INDEX, VEGETABLE_LABELS[NONE_CLASS_INDEX], 0.9f, true};
+    }
+}
+
+void tearDown(void) {
+}
+
+static void setTile(int tile, int classIndex, float confidence) {
+    scan.results[tile] = {classIndex, VEGETABLE_LABELS[classIndex], confidence, true};
+}
+
+// Four separate regions in the corners of the frame
+static void useCornerRegions() {
+    scan.numRegions = 4;
+    scan.regions[0] = {0, 0, 160, 120};
+    scan.regions[1] = {160, 0, 160, 120};    // Shares an edge with 0
+    scan.regions[2] = {0, 120, 160, 120};
+    scan.regions[3] = {160, 120, 160, 120};  // Shares only a corner with 0
+}
+
+void test_grid_regions_overlap_by_half(void) {
+    TEST_ASSERT_EQUAL_INT(9, scan.numRegions);
+    TEST_ASSERT_EQUAL_INT(0, scan.regions[0].x);
+    TEST_ASSERT_EQUAL_INT(80, scan.regions[1].x);
+    TEST_ASSERT_EQUAL_INT(160, scan.regions[2].x);
+    TEST_ASSERT_EQUAL_INT(60, scan.regions[3].y);
+    TEST_ASSERT_EQUAL_INT(120, scan.regions[6].y);
+    for (int i = 0; i < 9; i++) {
+        TEST_ASSERT_EQUAL_INT(160, scan.regions[i].width);
+        TEST_ASSERT_EQUAL_INT(120, scan.regions[i].height);
+    }
+    // Last column and row reach the frame edge
+    TEST_ASSERT_EQUAL_INT(320, scan.regions[8].x + scan.regions[8].width);
+    TEST_ASSERT_EQUAL_INT(240, scan.regions[8].y + scan.regions[8].height);
+}
+
+void test_single_region_is_whole_frame(void) {
+    ImageRegion regions[MAX_SCAN_REGIONS];
+    TEST_ASSERT_EQUAL_INT(1, makeGridRegions(320, 240, 1, 1, regions));
+    TEST_ASSERT_EQUAL_INT(320, regions[0].width);
+    TEST_ASSERT_EQUAL_INT(240, regions[0].height);
+}
+
+void test_grid_is_capped(void) {
+    ImageRegion regions[MAX_SCAN_REGIONS];
+    TEST_ASSERT_EQUAL_INT(MAX_SCAN_REGIONS, makeGridRegions(300, 300, 4, 4, regions));
+    TEST_ASSERT_EQUAL_INT(0, makeGridRegions(300, 300, 0, 2, regions));
+}
+
+void test_one_item_spanning_all_tiles_counts_once(void) {
+    for (int i = 0; i < 9; i++) setTile(i, TOMATO, 0.9f);
+    countScanItems(scan, 0.5f);
+    TEST_ASSERT_EQUAL_INT(1, scan.itemCounts[TOMATO]);
+    TEST_ASSERT_EQUAL_INT(1, scan.totalItems);
+}
+
+void test_item_on_tile_edge_counts_once(void) {
+    // Seen by the left, centre and right regions of the middle row
+    setTile(3, TOMATO, 0.9f);
+    setTile(4, TOMATO, 0.9f);
+    setTile(5, TOMATO, 0.9f);
+    countScanItems(scan, 0.5f);
+    TEST_ASSERT_EQUAL_INT(1, scan.itemCounts[TOMATO]);
+}
+
+void test_items_in_opposite_corners_are_separate(void) {
+    setTile(0, TOMATO, 0.9f);
+    setTile(8, TOMATO, 0.9f);  // Regions 0 and 8 do not overlap
+    countScanItems(scan, 0.5f);
+    TEST_ASSERT_EQUAL_INT(2, scan.itemCounts[TOMATO]);
+}
+
+void test_adjacent_tiles_are_separate(void) {
+    useCornerRegions();
+    setTile(0, TOMATO, 0.9f);
+    setTile(1, TOMATO, 0.9f);  // Shares an edge with tile 0
+    countScanItems(scan, 0.5f);
+    TEST_ASSERT_EQUAL_INT(2, scan.itemCounts[TOMATO]);
+}
+
+void test_diagonal_tiles_are_separate(void) {
+    useCornerRegions();
+    setTile(0, TOMATO, 0.9f);
+    setTile(3, TOMATO, 0.9f);  // Shares only a corner with tile 0
+    countScanItems(scan, 0.5f);
+    TEST_ASSERT_EQUAL_INT(2, scan.itemCounts[TOMATO]);
+}
+
+void test_separate_regions_counted_per_class(void) {
+    setTile(0, TOMATO, 0.9f);
+    setTile(8, LEMON, 0.8f);
+    countScanItems(scan, 0.5f);
+    TEST_ASSERT_EQUAL_INT(1, scan.itemCounts[TOMATO]);
+    TEST_ASSERT_EQUAL_INT(1, scan.itemCounts[LEMON]);
+    TEST_ASSERT_EQUAL_INT(2, scan.totalItems);
+}
+
+void test_overlapping_regions_merge(void) {
+    scan.numRegions = 3;
+    scan.regions[0] = {0, 0, 100, 100};
+    scan.regions[1] = {50, 50, 100, 100};    // Overlaps region 0
+    scan.regions[2] = {140, 140, 100, 100};  // Overlaps region 1 only
+    for (int i = 0; i < 3; i++) setTile(i, TOMATO, 0.9f);
+    countScanItems(scan, 0.5f);
+    TEST_ASSERT_EQUAL_INT(1, scan.itemCounts[TOMATO]);
+
+    setTile(1, LEMON, 0.9f);  // Different class breaks the chain
+    countScanItems(scan, 0.5f);
+    TEST_ASSERT_EQUAL_INT(2, scan.itemCounts[TOMATO]);
+    TEST_ASSERT_EQUAL_INT(1, scan.itemCounts[LEMON]);
+}
+
+void test_none_and_low_confidence_not_counted(void) {
+    setTile(0, TOMATO, 0.3f);
+    setTile(1, NONE_CLASS_INDEX, 0.99f);
+    scan.results[2] = {TOMATO, VEGETABLE_LABELS[TOMATO], 0.9f, false};
+    countScanItems(scan, 0.5f);
+    TEST_ASSERT_EQUAL_INT(0, scan.totalItems);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_grid_regions_overlap_by_half);
+    RUN_TEST(test_single_region_is_whole_frame);
+    RUN_TEST(test_grid_is_capped);
+    RUN_TEST(test_one_item_spanning_all_tiles_counts_once);
+    RUN_TEST(test_item_on_tile_edge_counts_once);
+    RUN_TEST(test_items_in_opposite_corners_are_separate);
+    RUN_TEST(test_adjacent_tiles_are_separate);
+    RUN_TEST(test_diagonal_tiles_are_separate);
+    RUN_TEST(test_separate_regions_counted_per_class);
+    RUN_TEST(test_overlapping_regions_merge);
+    RUN_TEST(test_none_and_low_confidence_not_counted);
+    return UNITY_END();
+}